@@ -62,10 +62,12 @@ TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Face>& shapes);
 /**
  * Boolean subtraction with two lists of arguments.
  * negative is subtracted from positive, i.e. tools is negative, arguments is
- * positive
+ * positive. If runParallel is set the boolean operation is run on several
+ * threads.
  */
 TopoDS_Shape Cut(const TopTools_ListOfShape& positive,
-                 const TopTools_ListOfShape& negative);
+                 const TopTools_ListOfShape& negative,
+                 bool runParallel = false);
 
 /**
  * Boolean subtraction with two lists of arguments.
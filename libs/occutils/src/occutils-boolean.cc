@@ -51,7 +51,7 @@ TopoDS_Shape Fuse(const std::initializer_list<TopoDS_Shape>& shapes) {
 }
 
 TopoDS_Shape Cut(const TopTools_ListOfShape& positive,
-                 const TopTools_ListOfShape& negative) {
+                 const TopTools_ListOfShape& negative, bool runParallel) {
   if (positive.Size() == 0) {
     throw std::invalid_argument("Cut positive must have at least one shape!");
   }
@@ -63,6 +63,7 @@ TopoDS_Shape Cut(const TopTools_ListOfShape& positive,
   BRepAlgoAPI_Cut cut;
   cut.SetArguments(positive);
   cut.SetTools(negative);
+  cut.SetRunParallel(runParallel);
   // Run cut
   cut.Build();
   return cut.Shape();  // Raises NotDone if not done.
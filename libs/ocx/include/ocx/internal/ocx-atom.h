@@ -0,0 +1,223 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_ATOM_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_ATOM_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace ocx::utils {
+
+// clang-format off
+/**
+ * The OCX local names known at compile time. Each gets a fixed Atom, any
+ * other name is interned on first use.
+ */
+#define OCX_ATOM_LIST(ATOM)                                                   \
+  ATOM(AP_Pos)                                                                \
+  ATOM(BarSection)                                                            \
+  ATOM(BlockCoefficient)                                                      \
+  ATOM(BoundingBox)                                                           \
+  ATOM(Center)                                                                \
+  ATOM(CenterOfGravity)                                                       \
+  ATOM(Circle3D)                                                              \
+  ATOM(CircumArc3D)                                                           \
+  ATOM(CircumCircle3D)                                                        \
+  ATOM(ClassCatalogue)                                                        \
+  ATOM(ClassificationData)                                                    \
+  ATOM(ComposedOf)                                                            \
+  ATOM(CompositeCurve3D)                                                      \
+  ATOM(Cone3D)                                                                \
+  ATOM(Contour)                                                               \
+  ATOM(ControlPoint)                                                          \
+  ATOM(ControlPtList)                                                         \
+  ATOM(CoordinateSystem)                                                      \
+  ATOM(CutBy)                                                                 \
+  ATOM(Cylinder3D)                                                            \
+  ATOM(DeepestEquilibriumWL)                                                  \
+  ATOM(Description)                                                           \
+  ATOM(DesignSpeed)                                                           \
+  ATOM(Diameter)                                                              \
+  ATOM(DistanceToAP)                                                          \
+  ATOM(DryWeight)                                                             \
+  ATOM(Ellipse3D)                                                             \
+  ATOM(EndPoint)                                                              \
+  ATOM(ExtrudedSurface)                                                       \
+  ATOM(FaceBoundaryCurve)                                                     \
+  ATOM(FP_Pos)                                                                \
+  ATOM(FrameTables)                                                           \
+  ATOM(FreeboardDeckHeight)                                                   \
+  ATOM(FreeboardLength)                                                       \
+  ATOM(FreeEdgeCurve3D)                                                       \
+  ATOM(GridPosition)                                                          \
+  ATOM(GridRef)                                                               \
+  ATOM(Header)                                                                \
+  ATOM(HeavyBallastDraught)                                                   \
+  ATOM(Height)                                                                \
+  ATOM(Hole2D)                                                                \
+  ATOM(Hole2DContour)                                                         \
+  ATOM(HoleRef)                                                               \
+  ATOM(HoleShapeCatalogue)                                                    \
+  ATOM(IntermediatePoint)                                                     \
+  ATOM(KnotVector)                                                            \
+  ATOM(LengthOfWaterline)                                                     \
+  ATOM(LimitedBy)                                                             \
+  ATOM(Line3D)                                                                \
+  ATOM(Lpp)                                                                   \
+  ATOM(MajorAxis)                                                             \
+  ATOM(MajorDiameter)                                                         \
+  ATOM(Max)                                                                   \
+  ATOM(Min)                                                                   \
+  ATOM(MinorAxis)                                                             \
+  ATOM(MinorDiameter)                                                         \
+  ATOM(MouldedBreadth)                                                        \
+  ATOM(MouldedDepth)                                                          \
+  ATOM(Normal)                                                                \
+  ATOM(NormalBallastDraught)                                                  \
+  ATOM(NURBS3D)                                                               \
+  ATOM(NURBSproperties)                                                       \
+  ATOM(NURBSSurface)                                                          \
+  ATOM(OcxItemPtr)                                                            \
+  ATOM(Offset)                                                                \
+  ATOM(Origin)                                                                \
+  ATOM(OuterContour)                                                          \
+  ATOM(Panel)                                                                 \
+  ATOM(PhysicalProperties)                                                    \
+  ATOM(Plane3D)                                                               \
+  ATOM(Plate)                                                                 \
+  ATOM(Point3D)                                                               \
+  ATOM(PolyLine3D)                                                            \
+  ATOM(Positions)                                                             \
+  ATOM(PrimaryAxis)                                                           \
+  ATOM(PrincipalParticulars)                                                  \
+  ATOM(ReferenceLocation)                                                     \
+  ATOM(ReferenceSurfaces)                                                     \
+  ATOM(RefPlane)                                                              \
+  ATOM(RuleLength)                                                            \
+  ATOM(ScantlingDraught)                                                      \
+  ATOM(SecondaryAxis)                                                         \
+  ATOM(SlammingDraughtEmptyFP)                                                \
+  ATOM(SlammingDraughtFullFP)                                                 \
+  ATOM(SlotContour)                                                           \
+  ATOM(Spacing)                                                               \
+  ATOM(SpeedFactor)                                                           \
+  ATOM(Sphere3D)                                                              \
+  ATOM(StartPoint)                                                            \
+  ATOM(StiffenedBy)                                                           \
+  ATOM(Stiffener)                                                             \
+  ATOM(SurfaceCollection)                                                     \
+  ATOM(SurfaceRef)                                                            \
+  ATOM(TraceLine)                                                             \
+  ATOM(Transformation)                                                        \
+  ATOM(U_NURBSproperties)                                                     \
+  ATOM(UknotVector)                                                           \
+  ATOM(UnboundedGeometry)                                                     \
+  ATOM(Unit)                                                                  \
+  ATOM(UnitSet)                                                               \
+  ATOM(UnitsML)                                                               \
+  ATOM(UnitSymbol)                                                            \
+  ATOM(UpperDeckArea)                                                         \
+  ATOM(V_NURBSproperties)                                                     \
+  ATOM(Vessel)                                                                \
+  ATOM(VesselGrid)                                                            \
+  ATOM(VknotVector)                                                           \
+  ATOM(WaterPlaneArea)                                                        \
+  ATOM(Width)                                                                 \
+  ATOM(X)                                                                     \
+  ATOM(XRefPlanes)                                                            \
+  ATOM(XSectionCatalogue)                                                     \
+  ATOM(Y)                                                                     \
+  ATOM(YRefPlanes)                                                            \
+  ATOM(Z)                                                                     \
+  ATOM(ZPosDeckline)                                                          \
+  ATOM(ZRefPlanes)
+// clang-format on
+
+/**
+ * Interned OCX local tag name. Comparing two atoms is an integer comparison,
+ * the same name always yields the same atom within the process.
+ */
+enum class Atom : std::uint32_t {
+  Unknown = 0,
+#define OCX_DECLARE_ATOM(name) name,
+  OCX_ATOM_LIST(OCX_DECLARE_ATOM)
+#undef OCX_DECLARE_ATOM
+};
+
+/**
+ * Number of atoms known at compile time, including Atom::Unknown
+ */
+#define OCX_COUNT_ATOM(name) +1
+inline constexpr std::size_t kNumKnownAtoms = 1 OCX_ATOM_LIST(OCX_COUNT_ATOM);
+#undef OCX_COUNT_ATOM
+
+/**
+ * Compile time map from atoms to values, e.g. the reader functions of the
+ * geometry types. The known atoms are dense integers, so the map is a directly
+ * indexed table and a lookup is a bounds check and an array access.
+ */
+template <typename T, std::size_t N>
+class AtomMap {
+ public:
+  constexpr explicit AtomMap(std::pair<Atom, T> const (&entries)[N]) {
+    for (std::size_t i = 0; i < N; i++) {
+      auto const idx = static_cast<std::size_t>(entries[i].first);
+      m_values[idx] = entries[i].second;
+      m_used[idx] = true;
+    }
+  }
+
+  /**
+   * Get the value of an atom
+   *
+   * @return a pointer to the value or nullptr if the atom is not in the map
+   */
+  [[nodiscard]] constexpr T const *Find(Atom atom) const {
+    auto const idx = static_cast<std::size_t>(atom);
+    if (idx >= kNumKnownAtoms || !m_used[idx]) {
+      return nullptr;
+    }
+    return &m_values[idx];
+  }
+
+ private:
+  std::array<T, kNumKnownAtoms> m_values{};
+  std::array<bool, kNumKnownAtoms> m_used{};
+};
+
+/**
+ * @brief Get the atom of a local name, i.e. a tag name without namespace
+ * prefix. Names not in OCX_ATOM_LIST are added to the table on first use.
+ * Thread safe, does not allocate for known names.
+ *
+ * @param localName the local name
+ * @return the atom of the name, Atom::Unknown for an empty name
+ */
+Atom InternAtom(std::string_view localName);
+
+/**
+ * @brief Get the local name of an atom
+ *
+ * @param atom the atom
+ * @return the local name, empty for Atom::Unknown or unknown atoms
+ */
+std::string_view AtomName(Atom atom);
+
+}  // namespace ocx::utils
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_ATOM_H_
@@ -18,16 +18,38 @@
 #include <LDOM_Element.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Wire.hxx>
+#include <functional>
 
 namespace ocx::reader::vessel::panel::composed_of {
 
-[[nodiscard]] TopoDS_Shape ReadComposedOf(LDOM_Element const &panelN,
-                                          bool withLimitedBy = false);
+/**
+ * @brief Read the Plates a Panel is composed of. The Plates are built right
+ * away except for their LimitedBy, which may refer to Panels and Plates not
+ * read yet. The OCAF shapes are added once the ComposedOf is finished.
+ *
+ * @param panelN the Panel element
+ * @return the function resolving the LimitedBy of the Plates and assembling
+ * the ComposedOf, to be called once the referenced surfaces are registered
+ */
+[[nodiscard]] std::function<TopoDS_Shape()> ReadComposedOf(
+    LDOM_Element const &panelN);
+
+/**
+ * @brief Only read and register the UnboundedGeometry of the Plates a Panel
+ * is composed of, so the LimitedBy of other Panels can refer to them
+ */
+void RegisterPlateGeometries(LDOM_Element const &panelN);
+
 namespace {  // anonymous namespace
 
-[[nodiscard]] TopoDS_Shape ReadPlate(LDOM_Element const &panelN,
-                                     LDOM_Element const &plateN,
-                                     bool withLimitedBy = false);
+[[nodiscard]] std::function<TopoDS_Shape()> ReadPlate(
+    LDOM_Element const &panelN, LDOM_Element const &plateN);
+
+/**
+ * Get the UnboundedGeometry of a Plate, read and registered if not yet done
+ */
+[[nodiscard]] TopoDS_Shape RegisterPlateGeometry(LDOM_Element const &panelN,
+                                                 LDOM_Element const &plateN);
 
 [[nodiscard]] TopoDS_Shape ReadBracket(LDOM_Element const &bracketN);
 
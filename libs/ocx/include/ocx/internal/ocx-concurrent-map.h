@@ -0,0 +1,164 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_CONCURRENT_MAP_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_CONCURRENT_MAP_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "ocx/internal/ocx-guid.h"
+
+namespace ocx::utils {
+
+/**
+ * Lock-striped map for registries which are written and read from many
+ * threads. The entries are distributed over NumShards independent maps by the
+ * hash of their key, each guarded by its own reader-writer lock, so threads
+ * only contend when they access the same shard.
+ *
+ * Keys are either binary GUIDs or strings. Values are returned by copy, as a
+ * reference into a shard would not be protected by its lock anymore.
+ */
+template <typename Key, typename Value, std::size_t NumShards = 16>
+class ConcurrentMap {
+  static_assert((NumShards & (NumShards - 1)) == 0,
+                "NumShards must be a power of two");
+
+  static constexpr bool kGuidKey = std::is_same_v<Key, Guid>;
+  using LookupKey = std::conditional_t<kGuidKey, Guid, std::string_view>;
+  using Map = std::conditional_t<kGuidKey, GuidMap<Value>,
+                                 std::map<std::string, Value, std::less<>>>;
+
+ public:
+  void Insert(LookupKey const &key, Value const &value) {
+    Shard &shard = ShardOf(key);
+    std::unique_lock lock(shard.mutex);
+    if constexpr (kGuidKey) {
+      shard.map[key] = value;
+    } else {
+      shard.map.insert_or_assign(std::string(key), value);
+    }
+  }
+
+  [[nodiscard]] std::optional<Value> Find(LookupKey const &key) const {
+    Shard const &shard = ShardOf(key);
+    std::shared_lock lock(shard.mutex);
+    if constexpr (kGuidKey) {
+      if (Value const *res = shard.map.Find(key); res != nullptr) {
+        return *res;
+      }
+    } else {
+      if (auto res = shard.map.find(key); res != shard.map.end()) {
+        return res->second;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void Clear() {
+    for (Shard &shard : m_shards) {
+      std::unique_lock lock(shard.mutex);
+      shard.map = Map();
+    }
+  }
+
+ private:
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    Map map;
+  };
+
+  std::array<Shard, NumShards> m_shards;
+
+  [[nodiscard]] static std::size_t ShardIndex(LookupKey const &key) {
+    if constexpr (kGuidKey) {
+      // The slot in the GuidMap is taken from the low bits, use the high ones
+      return static_cast<std::size_t>(key.hi >> 56) & (NumShards - 1);
+    } else {
+      return std::hash<std::string_view>{}(key) & (NumShards - 1);
+    }
+  }
+
+  Shard &ShardOf(LookupKey const &key) { return m_shards[ShardIndex(key)]; }
+
+  Shard const &ShardOf(LookupKey const &key) const {
+    return m_shards[ShardIndex(key)];
+  }
+};
+
+/**
+ * Map for read-mostly registries like the hole catalogue or the RefPlanes,
+ * which are filled once and then read by many threads. Readers work on an
+ * immutable snapshot without taking a lock. A new snapshot is published by
+ * the first read after a write, so filling the map costs a single copy.
+ */
+template <typename Value>
+class SnapshotMap {
+  using Map = std::map<std::string, Value, std::less<>>;
+
+ public:
+  SnapshotMap() : m_snapshot(std::make_shared<Map const>()) {}
+
+  void Insert(std::string_view key, Value const &value) {
+    std::lock_guard lock(m_mutex);
+    m_pending.insert_or_assign(std::string(key), value);
+    m_dirty.store(true, std::memory_order_release);
+  }
+
+  [[nodiscard]] std::optional<Value> Find(std::string_view key) const {
+    std::shared_ptr<Map const> snapshot = Snapshot();
+    if (auto res = snapshot->find(key); res != snapshot->end()) {
+      return res->second;
+    }
+    return std::nullopt;
+  }
+
+  void Clear() {
+    std::lock_guard lock(m_mutex);
+    m_pending.clear();
+    m_dirty.store(true, std::memory_order_release);
+  }
+
+ private:
+  mutable std::mutex m_mutex;
+  Map m_pending;
+  mutable std::atomic<bool> m_dirty{false};
+  mutable std::shared_ptr<Map const> m_snapshot;
+
+  std::shared_ptr<Map const> Snapshot() const {
+    if (m_dirty.load(std::memory_order_acquire)) {
+      std::lock_guard lock(m_mutex);
+      if (m_dirty.load(std::memory_order_relaxed)) {
+        std::atomic_store(&m_snapshot, std::make_shared<Map const>(m_pending));
+        m_dirty.store(false, std::memory_order_release);
+      }
+    }
+    return std::atomic_load(&m_snapshot);
+  }
+};
+
+}  // namespace ocx::utils
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_CONCURRENT_MAP_H_
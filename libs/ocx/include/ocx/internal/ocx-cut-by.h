@@ -16,7 +16,9 @@
 #define OCX_INCLUDE_OCX_INTERNAL_OCX_CUT_BY_H_
 
 #include <LDOM_Element.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopoDS_Wire.hxx>
 
 namespace ocx::vessel::panel::cut_by {
 
@@ -27,6 +29,14 @@ namespace {  // anonymous namespace
 
 [[nodiscard]] TopoDS_Wire ReadCutGeometry(LDOM_Element const &stiffenerN);
 
+/**
+ * Check if a hole contour lies in the plane of a planar face and completely
+ * inside of it without touching any of its boundaries, so it can be added to
+ * the face as an inner wire without a boolean operation
+ */
+[[nodiscard]] bool IsInnerWire(TopoDS_Face const &face,
+                               TopoDS_Wire const &wire);
+
 }  // namespace
 
 }  // namespace ocx::vessel::panel::cut_by
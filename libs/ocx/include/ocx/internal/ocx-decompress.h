@@ -0,0 +1,53 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_DECOMPRESS_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_DECOMPRESS_H_
+
+#include <istream>
+#include <memory>
+
+namespace ocx::stream {
+
+enum class Compression { None, Gzip, Zstd };
+
+/**
+ * @brief Detect the compression of a stream by its magic bytes. The stream
+ * position is restored afterwards.
+ *
+ * @param is the stream to check
+ * @return the detected compression, Compression::None for plain files
+ */
+Compression DetectCompression(std::istream &is);
+
+/**
+ * Input stream decompressing a gzip or zstd compressed source. The
+ * decompression runs on its own thread and hands over the decompressed blocks
+ * through a bounded queue, so the parser never waits on a full decompression
+ * and no temporary file is needed. The stream is not seekable.
+ */
+class DecompressStream : public std::istream {
+ public:
+  DecompressStream(std::shared_ptr<std::istream> source,
+                   Compression compression);
+  ~DecompressStream() override;
+
+ private:
+  class Buffer;
+  std::unique_ptr<Buffer> m_buffer;
+};
+
+}  // namespace ocx::stream
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_DECOMPRESS_H_
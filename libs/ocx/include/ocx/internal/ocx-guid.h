@@ -0,0 +1,137 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_GUID_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_GUID_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ocx::utils {
+
+/**
+ * 128-bit binary representation of a GUID
+ */
+struct Guid {
+  std::uint64_t hi = 0;
+  std::uint64_t lo = 0;
+
+  bool operator==(Guid const &other) const {
+    return hi == other.hi && lo == other.lo;
+  }
+  bool operator!=(Guid const &other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Parse a GUID string like "1be545fd-f7e8-4750-8b11-1bf9ea083537",
+ * optionally enclosed in braces. Hyphens are ignored, hex digits are case
+ * insensitive.
+ *
+ * @param guid the GUID string
+ * @return the binary GUID or std::nullopt if the string is no valid GUID
+ */
+std::optional<Guid> ParseGuid(std::string_view guid);
+
+/**
+ * Open-addressing hash map from binary GUIDs to values, using linear probing.
+ * Lookups do not allocate; entries are never removed except by Clear.
+ */
+template <typename T>
+class GuidMap {
+ public:
+  /**
+   * Get the value for a key, the value is default constructed if missing
+   */
+  T &operator[](Guid const &key) {
+    if ((m_size + 1) * 2 > m_slots.size()) {
+      Grow();
+    }
+    std::size_t idx = SlotIndex(key);
+    while (m_slots[idx].used) {
+      if (m_slots[idx].key == key) {
+        return m_slots[idx].value;
+      }
+      idx = (idx + 1) & (m_slots.size() - 1);
+    }
+    m_slots[idx].used = true;
+    m_slots[idx].key = key;
+    m_size++;
+    return m_slots[idx].value;
+  }
+
+  /**
+   * Find the value for a key
+   *
+   * @return a pointer to the value or nullptr if the key is not present
+   */
+  [[nodiscard]] T const *Find(Guid const &key) const {
+    if (m_slots.empty()) {
+      return nullptr;
+    }
+    std::size_t idx = SlotIndex(key);
+    while (m_slots[idx].used) {
+      if (m_slots[idx].key == key) {
+        return &m_slots[idx].value;
+      }
+      idx = (idx + 1) & (m_slots.size() - 1);
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] std::size_t Size() const { return m_size; }
+
+  void Clear() {
+    m_slots.clear();
+    m_size = 0;
+  }
+
+ private:
+  struct Slot {
+    Guid key;
+    bool used = false;
+    T value{};
+  };
+
+  std::vector<Slot> m_slots;
+  std::size_t m_size = 0;
+
+  /**
+   * The slot to start probing at, the size of the table is a power of two
+   */
+  [[nodiscard]] std::size_t SlotIndex(Guid const &key) const {
+    // GUIDs are mostly random, mixing both halves is sufficient
+    std::uint64_t hash = (key.hi ^ (key.lo * 0x9E3779B97F4A7C15ULL));
+    hash ^= hash >> 32;
+    return static_cast<std::size_t>(hash) & (m_slots.size() - 1);
+  }
+
+  void Grow() {
+    std::vector<Slot> old = std::move(m_slots);
+    m_slots = std::vector<Slot>(old.empty() ? 64 : old.size() * 2);
+    m_size = 0;
+    for (Slot &slot : old) {
+      if (slot.used) {
+        (*this)[slot.key] = std::move(slot.value);
+      }
+    }
+  }
+};
+
+}  // namespace ocx::utils
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_GUID_H_
@@ -15,8 +15,12 @@
 #ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_LIMITED_BY_READER_H_
 #define OCX_INCLUDE_OCX_INTERNAL_OCX_LIMITED_BY_READER_H_
 
+#include <Bnd_Box.hxx>
 #include <LDOM_Element.hxx>
+#include <TopoDS_Edge.hxx>
 #include <TopoDS_Shape.hxx>
+#include <functional>
+#include <optional>
 
 #include "ocx/internal/ocx-utils.h"
 #include "ocx/ocx-context.h"
@@ -47,6 +51,34 @@ namespace {  // anonymous namespace
 [[nodiscard]] TopoDS_Shape ReadGridRef(LDOM_Element const &panelN,
                                        LDOM_Element const &gridRefN);
 
+/**
+ * Get the unclipped intersection between the surface of a Panel and the one
+ * of the element it is limited by from the context, the intersection is
+ * computed and registered if not done yet
+ *
+ * @param offset the offset of the referenced surface
+ * @param intersect the function computing the intersection
+ * @return the intersection or std::nullopt if there is none
+ */
+[[nodiscard]] std::optional<TopoDS_Edge> CachedIntersection(
+    LDOM_Element const &panelN, LDOM_Element const &refN, double offset,
+    std::function<std::optional<TopoDS_Edge>()> const &intersect);
+
+/**
+ * Read the BoundingBox of an OcxItemPtr or GridRef, slightly expanded
+ *
+ * @return the bounding box or std::nullopt if there is none
+ */
+[[nodiscard]] std::optional<Bnd_Box> ReadBoundingBox(
+    LDOM_Element const &elementN);
+
+/**
+ * Check if the bounding box of a shape and the BoundingBox of a reference do
+ * not overlap, false if the shape box is void
+ */
+[[nodiscard]] bool IsOutOfBox(Bnd_Box const &shapeBox,
+                              Bnd_Box const &boundingBox);
+
 }  // namespace
 
 }  // namespace ocx::reader::shared::limited_by
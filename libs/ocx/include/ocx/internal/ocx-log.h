@@ -18,6 +18,8 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <mutex>
+
 namespace ocx {
 
 /**
@@ -26,12 +28,13 @@ namespace ocx {
 class Log {
  public:
   /**
-   * Initialize the ocx logging system
+   * Initialize the ocx logging system. Calls are counted, so several readers
+   * may initialize the logging system at the same time.
    */
   static void Initialize();
 
   /**
-   * Shutdown the ocx logging system
+   * Shutdown the ocx logging system once the last user has called Shutdown
    */
   static void Shutdown();
 
@@ -42,6 +45,12 @@ class Log {
    * shutdown when the ocx library is unloaded or not.
    */
   static bool m_initializedThroughConfigFile;
+
+  /**
+   * Number of Initialize calls not yet matched by a Shutdown call
+   */
+  static int m_users;
+  static std::mutex m_mutex;
 };
 
 }  // namespace ocx
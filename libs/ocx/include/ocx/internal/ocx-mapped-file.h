@@ -0,0 +1,68 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_MAPPED_FILE_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "ocx/internal/ocx-utils.h"
+
+namespace ocx::stream {
+
+/**
+ * Read-only memory mapping of a complete file. The parser reads straight from
+ * the mapped pages, so the file content is not copied through iostream
+ * buffers and the pages are shared with the OS page cache.
+ */
+class MappedFile {
+ public:
+  MappedFile(MappedFile const &) = delete;
+  MappedFile &operator=(MappedFile const &) = delete;
+  ~MappedFile();
+
+  /**
+   * Map the given file into memory
+   *
+   * @param filename the file to map
+   * @return the mapped file or nullptr if the file could not be mapped
+   */
+  static std::shared_ptr<MappedFile> Open(std::string const &filename);
+
+  /**
+   * Get the mapped file content
+   */
+  [[nodiscard]] std::string_view Data() const;
+
+ private:
+  SHARED_PTR_CREATE(MappedFile);
+  MappedFile() = default;
+
+  char const *m_data = nullptr;
+  std::size_t m_size = 0;
+
+#ifdef _WIN32
+  void *m_file = nullptr;
+  void *m_mapping = nullptr;
+#else
+  int m_fd = -1;
+#endif
+};
+
+}  // namespace ocx::stream
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_MAPPED_FILE_H_
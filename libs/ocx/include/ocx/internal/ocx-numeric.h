@@ -0,0 +1,57 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_NUMERIC_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_NUMERIC_H_
+
+#include <cstdint>
+#include <string_view>
+
+namespace ocx::utils {
+
+/**
+ * The length units supported in the OCX UnitsML section
+ */
+enum class LengthUnit : std::uint8_t { Unknown, M, Dm, Cm, Mm };
+
+/**
+ * @brief Get the length unit of a UnitsML unit symbol
+ *
+ * @param symbol the unit symbol, one of m, dm, cm, mm
+ * @return the length unit or LengthUnit::Unknown
+ */
+LengthUnit ParseLengthUnit(std::string_view symbol);
+
+/**
+ * @brief Get the factor to convert a length unit to meters
+ *
+ * @param unit the length unit
+ * @return the factor, 1.0 for LengthUnit::Unknown
+ */
+double LengthUnitFactor(LengthUnit unit);
+
+/**
+ * @brief Parse a floating point number as written in an XML attribute.
+ * Locale independent and without allocation. Leading and trailing whitespace
+ * and a leading '+' are accepted.
+ *
+ * @param text the text to parse
+ * @param value the variable to put the value, not touched on failure
+ * @return true if the whole text is a valid number, false otherwise
+ */
+bool ParseDouble(std::string_view text, double &value);
+
+}  // namespace ocx::utils
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_NUMERIC_H_
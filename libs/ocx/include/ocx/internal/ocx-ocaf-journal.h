@@ -0,0 +1,93 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_OCAF_JOURNAL_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_OCAF_JOURNAL_H_
+
+#include <Quantity_Color.hxx>
+#include <TopoDS_Shape.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_ColorType.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ocx {
+
+/**
+ * Records the shapes added to the OCAF document while a part of the model is
+ * built on a worker thread. The OCAF document is not thread-safe, so the
+ * recorded shapes are added later on by a single thread in the order they
+ * were recorded.
+ */
+class OCAFJournal {
+ public:
+  /**
+   * Binds a journal to the calling thread for the lifetime of the Scope.
+   * OCXContext::AddOCAFShape records into the bound journal instead of
+   * modifying the OCAF document.
+   */
+  class Scope {
+   public:
+    explicit Scope(OCAFJournal &journal);
+    ~Scope();
+
+    Scope(Scope const &) = delete;
+    Scope &operator=(Scope const &) = delete;
+
+   private:
+    OCAFJournal *m_previous;
+  };
+
+  /**
+   * Get the journal bound to the calling thread
+   *
+   * @return the journal or nullptr if none is bound
+   */
+  [[nodiscard]] static OCAFJournal *Current();
+
+  void Record(TopoDS_Shape const &shape, bool makeAssembly, std::string name,
+              std::optional<Quantity_Color> const &color,
+              XCAFDoc_ColorType colorType);
+
+  /**
+   * Append the shapes recorded in another journal
+   */
+  void Append(OCAFJournal const &journal);
+
+  /**
+   * Add the recorded shapes to the OCAF document in the recorded order
+   */
+  void Replay(opencascade::handle<XCAFDoc_ShapeTool> const &shapeTool,
+              opencascade::handle<XCAFDoc_ColorTool> const &colorTool) const;
+
+ private:
+  struct Entry {
+    TopoDS_Shape shape;
+    bool makeAssembly;
+    std::string name;
+    std::optional<Quantity_Color> color;
+    XCAFDoc_ColorType colorType;
+  };
+
+  std::vector<Entry> m_entries;
+
+  static thread_local OCAFJournal *s_current;
+};
+
+}  // namespace ocx
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_OCAF_JOURNAL_H_
@@ -0,0 +1,75 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_INDEX_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_INDEX_H_
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ocx/internal/ocx-panel-stream.h"
+
+namespace ocx::stream {
+
+/**
+ * Get the path of the sidecar index of an OCX file (<filename>.ocxidx)
+ */
+std::string PanelIndexPath(std::string const &filename);
+
+/**
+ * @brief Write the sidecar index of an OCX file. The index holds the byte
+ * range, GUIDRef and id of each Panel and the GUIDRefs of its Plates and is
+ * keyed by the file size and modification time of the OCX file.
+ *
+ * @param filename the OCX file the Panel ranges belong to
+ * @param panels the Panel ranges to store
+ * @return true if the index could be written, false otherwise
+ */
+bool WritePanelIndex(std::string const &filename,
+                     std::vector<PanelRange> const &panels);
+
+/**
+ * @brief Read the sidecar index of an OCX file
+ *
+ * @param filename the OCX file to read the index for
+ * @param panels the Panel ranges read from the index
+ * @return true if an index exists and matches the current file size and
+ * modification time, false otherwise
+ */
+bool ReadPanelIndex(std::string const &filename,
+                    std::vector<PanelRange> &panels);
+
+/**
+ * @brief Assemble the skeleton document, i.e. everything except the Panel
+ * subtrees, from the given Panel ranges without scanning the document
+ *
+ * @param is the stream of the complete document
+ * @param panels the Panel ranges in document order
+ * @param skeleton the document without the Panel subtrees
+ * @return true if the skeleton could be read, false otherwise
+ */
+bool BuildSkeleton(std::istream &is, std::vector<PanelRange> const &panels,
+                   std::string &skeleton);
+
+/**
+ * @brief Same as above, but for a document held in memory
+ */
+bool BuildSkeleton(std::string_view data, std::vector<PanelRange> const &panels,
+                   std::string &skeleton);
+
+}  // namespace ocx::stream
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_INDEX_H_
@@ -0,0 +1,196 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_STREAM_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_STREAM_H_
+
+#include <LDOM_Element.hxx>
+#include <istream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ocx/internal/ocx-mapped-file.h"
+
+namespace ocx::stream {
+
+/**
+ * Read-only std::streambuf over an existing memory block. Used to feed
+ * LDOMParser without copying the data into a std::stringstream first.
+ * Seekable, so tellg/seekg work, e.g. for DetectCompression.
+ */
+class MemoryBuffer : public std::streambuf {
+ public:
+  MemoryBuffer(char const *begin, char const *end);
+
+ protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override;
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+};
+
+/**
+ * Byte range [begin, end) of a top-level <ocx:Panel> element in the file
+ * together with its GUIDRef and id attributes and the GUIDRefs of the Plates
+ * it is composed of
+ */
+struct PanelRange {
+  std::streamoff begin;
+  std::streamoff end;
+  std::string guid;
+  std::string id;
+  std::vector<std::string> plateGuids;
+};
+
+/**
+ * @brief Scan an OCX document once and split it into a skeleton document and
+ * the byte ranges of the top-level Panel elements below the Vessel element.
+ * The skeleton holds everything except the Panel subtrees, e.g. the Header,
+ * the ClassCatalogue, the CoordinateSystem and the ReferenceSurfaces.
+ *
+ * @param is the stream to scan, read from its current position
+ * @param skeleton the document without the Panel subtrees
+ * @param panels the byte ranges of the Panel subtrees in document order
+ * @return true if the document could be scanned, false otherwise
+ */
+bool SplitPanels(std::istream &is, std::string &skeleton,
+                 std::vector<PanelRange> &panels);
+
+/**
+ * @brief Same as above, but scans a document held in memory, e.g. a
+ * MappedFile. The Panel ranges are offsets into the given data.
+ */
+bool SplitPanels(std::string_view data, std::string &skeleton,
+                 std::vector<PanelRange> &panels);
+
+/**
+ * Provides the Panel elements of an OCX file one at a time. Each Panel is
+ * parsed into its own LDOM document which is released as soon as the returned
+ * element goes out of scope, so the memory is bounded by the largest Panel
+ * instead of the whole file.
+ */
+class PanelStream {
+ public:
+  PanelStream(std::shared_ptr<std::istream> is,
+              std::vector<PanelRange> ranges);
+
+  /**
+   * Read the Panels directly from the mapped file without copying them
+   */
+  PanelStream(std::shared_ptr<MappedFile> file, std::vector<PanelRange> ranges);
+
+  /**
+   * Get the number of Panel elements in the stream
+   */
+  [[nodiscard]] std::size_t Size() const;
+
+  /**
+   * Set the number of threads used to parse Panels in ReadPanels and Preload
+   */
+  void SetNumThreads(unsigned int numThreads);
+
+  [[nodiscard]] unsigned int NumThreads() const;
+
+  /**
+   * Parse the Panel at the given position into its own LDOM document
+   *
+   * @param idx the position of the Panel in document order
+   * @return the Panel element or a null element if it could not be parsed
+   */
+  [[nodiscard]] LDOM_Element ReadPanel(std::size_t idx);
+
+  /**
+   * Parse a range of Panels, each into its own LDOM document, in parallel on
+   * NumThreads() threads
+   *
+   * @param first the position of the first Panel in document order
+   * @param count the number of Panels to parse
+   * @return the Panel elements in document order, a null element for each
+   * Panel which could not be parsed
+   */
+  [[nodiscard]] std::vector<LDOM_Element> ReadPanels(std::size_t first,
+                                                     std::size_t count);
+
+  /**
+   * Parse the Panels at the given positions, each into its own LDOM document,
+   * in parallel on NumThreads() threads
+   *
+   * @param indices the positions of the Panels in document order
+   * @return the Panel elements in the order of the given positions, a null
+   * element for each Panel which could not be parsed
+   */
+  [[nodiscard]] std::vector<LDOM_Element> ReadPanels(
+      std::vector<std::size_t> const &indices);
+
+  /**
+   * Find a Panel by its GUIDRef or id attribute
+   *
+   * @param guidOrId the GUIDRef or id of the Panel
+   * @return the position of the Panel or std::nullopt if not found
+   */
+  [[nodiscard]] std::optional<std::size_t> FindPanel(
+      std::string_view guidOrId) const;
+
+  /**
+   * Find the Panel owning an element, i.e. the Panel itself or one of the
+   * Plates it is composed of, without parsing any Panel
+   *
+   * @param guid the GUIDRef of the Panel or Plate
+   * @return the position of the Panel or std::nullopt if not found
+   */
+  [[nodiscard]] std::optional<std::size_t> FindOwner(
+      std::string_view guid) const;
+
+  /**
+   * Get the byte ranges of all Panels in document order
+   */
+  [[nodiscard]] std::vector<PanelRange> const &Ranges() const;
+
+  /**
+   * Parse all Panels in parallel and keep them, afterwards ReadPanel and
+   * ReadPanels only hand out the already parsed elements
+   */
+  void Preload();
+
+ private:
+  std::shared_ptr<std::istream> m_stream;
+  std::shared_ptr<MappedFile> m_file;
+  std::vector<PanelRange> m_ranges;
+  std::string m_buffer;
+  unsigned int m_numThreads = 1;
+  std::map<std::string, std::size_t, std::less<>> m_guid2index;
+  std::map<std::string, std::size_t, std::less<>> m_plate2index;
+  std::vector<LDOM_Element> m_preloaded;
+
+  /**
+   * Get the raw data of a Panel, either from the mapped file or read into the
+   * given buffer
+   *
+   * @return the Panel data or an empty view if it could not be read
+   */
+  std::string_view GetPanelData(std::size_t idx, std::string &buffer);
+
+  [[nodiscard]] LDOM_Element ParsePanel(std::size_t idx,
+                                        std::string_view panelData) const;
+
+  void IndexRanges();
+};
+
+}  // namespace ocx::stream
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_STREAM_H_
@@ -15,18 +15,133 @@
 #ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_READER_H_
 #define OCX_INCLUDE_OCX_INTERNAL_OCX_PANEL_READER_H_
 
+#include <Bnd_Box.hxx>
 #include <LDOM_Element.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Wire.hxx>
+#include <cstddef>
+#include <functional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace ocx::reader::vessel::panel {
 
 void ReadPanels(LDOM_Element const &vesselN);
 
+/**
+ * @brief Call the callback for each Panel element of the Vessel in document
+ * order. If the document is read in streaming mode the Panels are parsed one
+ * at a time from the file, otherwise the DOM children of the Vessel are used.
+ *
+ * @param vesselN the Vessel element
+ * @param callback the function to call for each Panel element
+ */
+void ForEachPanel(LDOM_Element const &vesselN,
+                  std::function<void(LDOM_Element const &)> const &callback);
+
+/**
+ * @brief Call the callback for batches of Panel elements of the Vessel in
+ * document order. If the document is read in streaming mode each batch holds
+ * the Panels parsed at once and is released after the callback, otherwise a
+ * single batch holds all DOM children of the Vessel.
+ *
+ * @param vesselN the Vessel element
+ * @param callback the function to call for each batch of Panel elements
+ */
+void ForEachPanelBatch(
+    LDOM_Element const &vesselN,
+    std::function<void(std::vector<LDOM_Element> const &)> const &callback);
+
+/**
+ * @brief Same as above, but only for the Panels at the given positions of the
+ * PanelStream. Does nothing if the document is not read in streaming mode.
+ *
+ * @param indices the positions of the Panels in document order
+ * @param callback the function to call for each batch of Panel elements
+ */
+void ForEachPanelBatch(
+    std::vector<std::size_t> const &indices,
+    std::function<void(std::vector<LDOM_Element> const &)> const &callback);
+
+/**
+ * @brief Check a Panel against the selection criteria set in the OCXContext
+ * (SelectPanelGUIDs, SelectPanelName and SelectPanelBox)
+ *
+ * @param panelN the Panel element
+ * @return true if the Panel matches all set criteria
+ */
+[[nodiscard]] bool IsPanelSelected(LDOM_Element const &panelN);
+
 namespace {  // anonymous namespace
 
-[[nodiscard]] TopoDS_Shape ReadPanel(LDOM_Element const &panelN,
-                                     bool withLimitedBy = false);
+/**
+ * Build a Panel except for the LimitedBy of the Panel and its Plates
+ *
+ * @param panelN the Panel element
+ * @return the function resolving the LimitedBy and adding the Panel to the
+ * OCAF document, to be called once the referenced surfaces are registered
+ */
+[[nodiscard]] std::function<TopoDS_Shape()> ReadPanel(
+    LDOM_Element const &panelN);
+
+/**
+ * Get the bounding box of the points defining the OuterContour of a Panel.
+ * Cheap approximation of the Panel extent without building any geometry.
+ */
+[[nodiscard]] Bnd_Box ReadContourBox(LDOM_Element const &panelN);
+
+void AddPointsToBox(LDOM_Element const &elementN, Bnd_Box &box);
+
+/**
+ * Collect the GUIDRefs of the elements referenced by the LimitedBy of a Panel
+ */
+void CollectLimitedByRefs(LDOM_Element const &panelN,
+                          std::set<std::string, std::less<>> &refs);
+
+/**
+ * Collect the GUIDRefs referenced by the LimitedBy of a Panel and of the
+ * Plates it is composed of
+ */
+void CollectPanelLimitedByRefs(LDOM_Element const &panelN,
+                               std::set<std::string, std::less<>> &refs);
+
+/**
+ * Call the callback for the GUIDRef of a Panel and of each of its Plates, the
+ * elements the LimitedBy of other Panels may refer to
+ */
+void ForEachOwnedGuid(LDOM_Element const &panelN,
+                      std::function<void(std::string_view)> const &callback);
+
+/**
+ * Call the callback for each Plate the Panel is composed of
+ */
+void ForEachPlate(LDOM_Element const &panelN,
+                  std::function<void(LDOM_Element const &)> const &callback);
+
+/**
+ * Read and register the UnboundedGeometry of a Panel only
+ */
+void RegisterUnboundedGeometry(LDOM_Element const &panelN);
+
+/**
+ * Get the key a Panel is registered with, its GUIDRef or id
+ */
+[[nodiscard]] std::string PanelKey(LDOM_Element const &panelN);
+
+/**
+ * Get the number of streamed Panels parsed and built at once
+ */
+[[nodiscard]] std::size_t PanelBatchSize();
+
+/**
+ * Pass a batch of streamed Panels without the ones which could not be parsed
+ * to the callback and release them afterwards
+ */
+void HandOutBatch(
+    std::vector<LDOM_Element> batch,
+    std::function<void(std::vector<LDOM_Element> const &)> const &callback);
 
 }  // namespace
 
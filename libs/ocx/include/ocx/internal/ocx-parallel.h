@@ -0,0 +1,46 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_PARALLEL_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_PARALLEL_H_
+
+#include <cstddef>
+#include <functional>
+
+namespace ocx::utils {
+
+/**
+ * Resolve a thread count option, 0 stands for all available cores
+ */
+[[nodiscard]] unsigned int ResolveNumThreads(unsigned int numThreads);
+
+/**
+ * @brief Call the function for each index in [0, count) on up to numThreads
+ * threads, the calling thread being one of them. The threads take the next
+ * index from a shared counter, so threads done with cheap items early take
+ * over the remaining ones. The first exception thrown by the function is
+ * rethrown on the calling thread once all threads are done, no further items
+ * are started after an exception.
+ *
+ * @param count the number of items
+ * @param numThreads the maximum number of threads to use
+ * @param fn the function to call with the index of each item
+ */
+void ParallelFor(std::size_t count, unsigned int numThreads,
+                 std::function<void(std::size_t)> const &fn);
+
+}  // namespace ocx::utils
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_PARALLEL_H_
@@ -22,13 +22,11 @@
 
 namespace ocx::reader::vessel::panel::stiffened_by {
 
-[[nodiscard]] TopoDS_Shape ReadStiffenedBy(LDOM_Element const &panelN,
-                                           bool addShape = true);
+[[nodiscard]] TopoDS_Shape ReadStiffenedBy(LDOM_Element const &panelN);
 
 namespace {  // anonymous namespace
 
-[[nodiscard]] TopoDS_Shape ReadStiffener(LDOM_Element const &stiffenerN,
-                                         bool addShape = true);
+[[nodiscard]] TopoDS_Shape ReadStiffener(LDOM_Element const &stiffenerN);
 
 }  // namespace
 
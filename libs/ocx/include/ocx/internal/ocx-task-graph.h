@@ -0,0 +1,69 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef OCX_INCLUDE_OCX_INTERNAL_OCX_TASK_GRAPH_H_
+#define OCX_INCLUDE_OCX_INTERNAL_OCX_TASK_GRAPH_H_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace ocx::utils {
+
+/**
+ * A set of tasks with dependencies between them. Run executes each task once
+ * all of its dependencies are done, tasks without pending dependencies run
+ * concurrently. Tasks can only depend on tasks added before them, so the
+ * graph is acyclic by construction.
+ */
+class TaskGraph {
+ public:
+  using TaskId = std::size_t;
+
+  /**
+   * Add a task to the graph
+   *
+   * @param fn the function to execute
+   * @param dependencies the tasks which have to be done before this one
+   * @return the id of the new task
+   */
+  TaskId Add(std::function<void()> fn,
+             std::vector<TaskId> const &dependencies = {});
+
+  [[nodiscard]] std::size_t Size() const;
+
+  /**
+   * Execute all tasks on up to numThreads threads, the calling thread being
+   * one of them. Ready tasks are started in the order they were added. The
+   * first exception thrown by a task is rethrown once all running tasks are
+   * done, no further tasks are started after an exception.
+   *
+   * @param numThreads the maximum number of threads to use
+   */
+  void Run(unsigned int numThreads);
+
+ private:
+  struct Task {
+    std::function<void()> fn;
+    std::vector<TaskId> dependents;
+    std::size_t numDependencies = 0;
+  };
+
+  std::vector<Task> m_tasks;
+};
+
+}  // namespace ocx::utils
+
+#endif  // OCX_INCLUDE_OCX_INTERNAL_OCX_TASK_GRAPH_H_
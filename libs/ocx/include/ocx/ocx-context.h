@@ -15,19 +15,36 @@
 #ifndef OCX_INCLUDE_OCX_OCX_CONTEXT_H_
 #define OCX_INCLUDE_OCX_OCX_CONTEXT_H_
 
+#include <Bnd_Box.hxx>
 #include <LDOM_Element.hxx>
+#include <Quantity_Color.hxx>
 #include <TDocStd_Application.hxx>
 #include <TDocStd_Document.hxx>
+#include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shell.hxx>
 #include <XCAFDoc_ColorTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "ocx-helper.h"
 #include "ocx/internal/ocx-bar-section.h"
+#include "ocx/internal/ocx-concurrent-map.h"
+#include "ocx/internal/ocx-guid.h"
+#include "ocx/internal/ocx-numeric.h"
+#include "ocx/internal/ocx-ocaf-journal.h"
+#include "ocx/internal/ocx-panel-stream.h"
 #include "ocx/internal/ocx-principal-particulars-wrapper.h"
 #include "ocx/internal/ocx-refplane-wrapper.h"
 #include "ocx/internal/ocx-utils.h"
@@ -36,20 +53,76 @@
 namespace ocx {
 
 /**
- * Comparator to handle LDOM_Element as key in std::map
+ * Holds the state shared by the readers of an OCX document. The shape, bar
+ * section, hole and RefPlane registries may be used from several threads at
+ * once.
  */
-struct LDOMCompare {
-  bool operator()(LDOM_Element const &lhs, LDOM_Element const &rhs) const;
-};
-
 class OCXContext {
  public:
   OCXContext(OCXContext const &) = delete;
   OCXContext &operator=(OCXContext const &) = delete;
 
+  /**
+   * Create a new context for the given document. Contexts are independent of
+   * each other, so one process may read several documents one after another
+   * or at the same time.
+   *
+   * @param root the document root element
+   * @param nsPrefix the document tag prefix
+   * @return the new context
+   * @throws OCXInitializationFailedException if the root element is null
+   */
+  static std::shared_ptr<OCXContext> Create(LDOM_Element const &root,
+                                            std::string const &nsPrefix);
+
+  /**
+   * Binds a context to the calling thread for the lifetime of the Scope. The
+   * readers access the context they work on via GetInstance(). Scopes may be
+   * nested, the previously bound context is restored on destruction.
+   */
+  class Scope {
+   public:
+    explicit Scope(std::shared_ptr<OCXContext> ctx);
+    ~Scope();
+
+    Scope(Scope const &) = delete;
+    Scope &operator=(Scope const &) = delete;
+
+   private:
+    std::shared_ptr<OCXContext> m_previous;
+  };
+
+  /**
+   * Create a new context and bind it to the calling thread, replacing the
+   * context bound before
+   */
   static void Initialize(LDOM_Element const &root, std::string const &nsPrefix);
 
-  static std::shared_ptr<OCXContext> GetInstance();
+  /**
+   * @brief Get the context bound to the calling thread. Called for nearly
+   * every element read, so no reference count is touched. The context is
+   * owned by the binding Scope, the pointer must not be kept beyond it.
+   *
+   * @return the current context, never nullptr
+   * @throws OCXNotFoundException if no context is bound to the calling thread
+   */
+  static OCXContext *GetInstance();
+
+  /**
+   * Get the context bound to the calling thread as shared handle, e.g. to bind
+   * it to worker threads with a Scope
+   *
+   * @return the current context
+   * @throws OCXNotFoundException if no context is bound to the calling thread
+   */
+  static std::shared_ptr<OCXContext> GetShared();
+
+  /**
+   * Get the context bound to the calling thread without taking ownership
+   *
+   * @return the current context or nullptr if none is bound
+   */
+  [[nodiscard]] static OCXContext *Current();
 
   static inline bool CreateReferenceSurfaces = true;
 
@@ -64,6 +137,47 @@ class OCXContext {
 
   static inline bool CreateStiffenerTraces = true;
 
+  /**
+   * Read the Panel elements one at a time from the file instead of building
+   * the complete DOM up front. Reduces the peak memory for large files.
+   */
+  static inline bool StreamPanels = false;
+
+  /**
+   * Memory-map the input file and parse straight from the mapped pages
+   * instead of reading it through an iostream
+   */
+  static inline bool MapInputFile = false;
+
+  /**
+   * Number of threads used to parse the Panel elements, 0 to use all
+   * available cores. With more than one thread the Panels are parsed in
+   * parallel into separate documents below the shared document skeleton.
+   */
+  static inline unsigned int ParseThreads = 1;
+
+  /**
+   * Number of threads used to build the Panel geometry, 0 to use all
+   * available cores. The OCAF document is the same for any number of
+   * threads.
+   */
+  static inline unsigned int ReadThreads = 1;
+
+  /**
+   * Read the Panel byte ranges from a sidecar index (<file>.ocxidx) instead
+   * of scanning the file, the index is (re)written if missing or outdated
+   */
+  static inline bool UsePanelIndex = false;
+
+  /**
+   * Panel selection, only Panels matching all given criteria are read. The
+   * Panels referenced by the LimitedBy of a selected Panel are read as far as
+   * needed to resolve it. Unset criteria match all Panels.
+   */
+  static inline std::vector<std::string> SelectPanelGUIDs{};
+  static inline std::string SelectPanelName{};
+  static inline std::optional<Bnd_Box> SelectPanelBox{};
+
   static inline double MinX = -10;
   static inline double MaxX = 190;
   static inline double MinY = -50;
@@ -98,7 +212,7 @@ class OCXContext {
    * @return the factor to convert the given unit to the main unit defined by
    * the OCX document
    */
-  [[nodiscard]] double LoopupFactor(const std::string &unit) const;
+  [[nodiscard]] double LoopupFactor(std::string_view unit) const;
 
   /**
    * @brief Register a TopoDS_Shape by its LDOM_Element (matched by given
@@ -118,6 +232,54 @@ class OCXContext {
    */
   [[nodiscard]] TopoDS_Shape LookupShape(LDOM_Element const &element);
 
+  /**
+   * @brief Get the bounding box of a previously registered Shape, computed
+   * once when the Shape is registered
+   *
+   * @param element the LDOM_Element to lookup
+   * @return the bounding box if found, otherwise a void box
+   */
+  [[nodiscard]] Bnd_Box LookupShapeBox(LDOM_Element const &element);
+
+  /**
+   * Count a LimitedBy intersection skipped as the bounding boxes of the
+   * surfaces do not overlap the one of the limit
+   */
+  void CountSkippedIntersection();
+
+  /**
+   * Count a CutBy hole skipped as its bounding box does not overlap the one
+   * of the surface to cut
+   */
+  void CountSkippedCut();
+
+  [[nodiscard]] std::size_t SkippedIntersections() const;
+  [[nodiscard]] std::size_t SkippedCuts() const;
+
+  /**
+   * @brief Register the unclipped intersection of two surfaces, matched by
+   * their GUIDs. The offset is the one of the second surface, without offset
+   * the order of the surfaces does not matter.
+   *
+   * @param first the GUID of the first surface
+   * @param second the GUID of the second surface
+   * @param offset the offset of the second surface
+   * @param edge the intersection or a null edge if there is none
+   */
+  void RegisterIntersection(ocx::utils::Guid const &first,
+                            ocx::utils::Guid const &second, double offset,
+                            TopoDS_Edge const &edge);
+
+  /**
+   * @brief Get a previously registered intersection of two surfaces
+   *
+   * @return the intersection, a null edge if there is none, or std::nullopt
+   * if it is not registered yet
+   */
+  [[nodiscard]] std::optional<TopoDS_Edge> LookupIntersection(
+      ocx::utils::Guid const &first, ocx::utils::Guid const &second,
+      double offset) const;
+
   void RegisterHoleShape(std::string const &guid,
                          TopoDS_Shape const &holeShape);
 
@@ -199,19 +361,70 @@ class OCXContext {
   [[nodiscard]] ocx::context_entities::BarSection LookupBarSection(
       LDOM_Element const &element) const;
 
+  /**
+   * Register the stream providing the Panel elements if the document was
+   * read in streaming mode
+   *
+   * @param panelStream the PanelStream to register
+   */
+  void RegisterPanelStream(
+      std::shared_ptr<ocx::stream::PanelStream> const &panelStream);
+
+  /**
+   * Get the stream providing the Panel elements
+   *
+   * @return the PanelStream or nullptr if the document was read completely
+   */
+  [[nodiscard]] std::shared_ptr<ocx::stream::PanelStream> GetPanelStream()
+      const;
+
+  /**
+   * Get the generation of the cached meta information of this document. The
+   * generation is unique across all contexts, so the per-thread meta caches
+   * never mix up elements of different documents.
+   */
+  [[nodiscard]] std::uint64_t MetaCacheGeneration() const;
+
+  /**
+   * Start a new generation, the threads working on this document drop their
+   * cached meta information on their next access
+   */
+  void NextMetaCacheGeneration();
+
   void OCAFDoc(const opencascade::handle<TDocStd_Document> &handle);
   [[nodiscard]] opencascade::handle<TDocStd_Document> OCAFDoc() const;
   [[nodiscard]] opencascade::handle<XCAFDoc_ShapeTool> OCAFShapeTool() const;
   [[nodiscard]] opencascade::handle<XCAFDoc_ColorTool> OCAFColorTool() const;
 
+  /**
+   * Add a shape to the OCAF document, name and optionally color it. Recorded
+   * into the OCAFJournal bound to the calling thread if there is one.
+   *
+   * @param shape the shape to add
+   * @param makeAssembly true to add the shape as an assembly of its children
+   * @param name the name of the new label
+   * @param color the color of the new label, unset to not color it
+   * @param colorType the kind of color to set
+   */
+  void AddOCAFShape(TopoDS_Shape const &shape, bool makeAssembly,
+                    std::string const &name,
+                    std::optional<Quantity_Color> const &color = std::nullopt,
+                    XCAFDoc_ColorType colorType = XCAFDoc_ColorGen);
+
+  /**
+   * Add the shapes recorded in the journal to the OCAF document, or to the
+   * OCAFJournal bound to the calling thread if there is one
+   */
+  void AddOCAFShapes(OCAFJournal const &journal);
+
  private:
   SHARED_PTR_CREATE(OCXContext);
   OCXContext(LDOM_Element const &root, std::string nsPrefix);
 
   /**
-   * The OCXContext instance
+   * The context bound to the current thread
    */
-  static std::shared_ptr<OCXContext> s_instance;
+  static thread_local std::shared_ptr<OCXContext> s_current;
 
   /**
    * The document root element
@@ -223,7 +436,11 @@ class OCXContext {
    */
   std::string m_nsPrefix;
 
-  std::map<std::string, double, std::less<>> unit2factor;
+  /**
+   * Map of UnitsML unit ID to its length unit. Filled on construction and
+   * read-only afterwards.
+   */
+  std::map<std::string, ocx::utils::LengthUnit, std::less<>> unit2LengthUnit;
 
   /**
    * The ocx PrincipalParticular
@@ -235,22 +452,96 @@ class OCXContext {
    */
   std::vector<ocx::context_entities::VesselGridWrapper> m_vesselGrid;
 
-  std::map<LDOM_Element, TopoDS_Shape, LDOMCompare> LDOM2TopoDS_Shape;
+  /**
+   * A registered shape together with its bounding box
+   */
+  struct RegisteredShape {
+    TopoDS_Shape shape;
+    Bnd_Box box;
+  };
+
+  /**
+   * Map of element GUID to TopoDS_Shape. Keyed by the binary GUID instead of
+   * LDOM_Element to not keep the per-Panel documents alive when streaming.
+   */
+  ocx::utils::ConcurrentMap<ocx::utils::Guid, RegisteredShape> m_guid2Shape;
+
+  /**
+   * Map of element ID (or localRef) to TopoDS_Shape for elements without GUID
+   */
+  ocx::utils::ConcurrentMap<std::string, RegisteredShape> m_id2Shape;
+
+  /**
+   * The stream providing the Panel elements, nullptr if not streaming
+   */
+  std::shared_ptr<ocx::stream::PanelStream> m_panelStream;
 
   /**
-   * Map of LDOM_Element to BarSection
+   * Map of element GUID to BarSection
    */
-  std::map<LDOM_Element, ocx::context_entities::BarSection, LDOMCompare>
-      LDOM2BarSection;
+  ocx::utils::ConcurrentMap<ocx::utils::Guid,
+                            ocx::context_entities::BarSection>
+      m_guid2BarSection;
 
-  std::map<std::string, TopoDS_Shape, std::less<>> m_holeCatalogue;
+  /**
+   * Map of element ID (or localRef) to BarSection for elements without GUID
+   */
+  ocx::utils::ConcurrentMap<std::string, ocx::context_entities::BarSection>
+      m_id2BarSection;
+
+  /**
+   * Map of GUID to hole shape, filled from the HoleShapeCatalogue
+   */
+  ocx::utils::SnapshotMap<TopoDS_Shape> m_holeCatalogue;
 
   /**
    * Map of GUID to RefPlaneWrapper
    */
-  std::map<std::string, ocx::context_entities::RefPlaneWrapper, std::less<>>
+  ocx::utils::SnapshotMap<ocx::context_entities::RefPlaneWrapper>
       GUID2RefPlane;
 
+  /**
+   * The generation of the cached meta information, see MetaCacheGeneration
+   */
+  std::atomic<std::uint64_t> m_metaCacheGeneration;
+
+  /**
+   * Surfaces and offset an intersection is registered for
+   */
+  struct IntersectionKey {
+    ocx::utils::Guid first;
+    ocx::utils::Guid second;
+    double offset;
+
+    bool operator<(IntersectionKey const &other) const;
+  };
+
+  [[nodiscard]] static IntersectionKey MakeIntersectionKey(
+      ocx::utils::Guid const &first, ocx::utils::Guid const &second,
+      double offset);
+
+  /**
+   * Map of surface pair to their intersection, see RegisterIntersection
+   */
+  std::map<IntersectionKey, TopoDS_Edge> m_intersections;
+  mutable std::shared_mutex m_intersectionsMutex;
+
+  /**
+   * Number of intersections and cuts skipped by the bounding box tests
+   */
+  std::atomic<std::size_t> m_skippedIntersections{0};
+  std::atomic<std::size_t> m_skippedCuts{0};
+
+  /**
+   * Guards the PrincipalParticulars, the VesselGrid and the PanelStream
+   */
+  mutable std::mutex m_entitiesMutex;
+
+  /**
+   * Serializes the modifications of the OCAF document
+   */
+  std::mutex m_ocafMutex;
+
   opencascade::handle<TDocStd_Document> ocafDoc;
   opencascade::handle<XCAFDoc_ShapeTool> ocafShapeTool;
   opencascade::handle<XCAFDoc_ColorTool> ocafColorTool;
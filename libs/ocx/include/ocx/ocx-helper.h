@@ -26,11 +26,14 @@
 #include <TColgp_Array2OfPnt.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Wire.hxx>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
 
+#include "ocx/internal/ocx-atom.h"
+#include "ocx/internal/ocx-guid.h"
 #include "ocx/internal/ocx-log.h"
 #include "ocx/ocx-context.h"
 
@@ -64,26 +67,53 @@ struct OCXMeta {
 
   std::string refType;
 
+  /**
+   * The GUID parsed into its binary form, std::nullopt if the element has no
+   * (valid) GUIDRef
+   */
+  std::optional<ocx::utils::Guid> guidKey;
+
   OCXMeta(char const *name, char const *id, char const *localRef,
           char const *guid, std::string refType)
       : name(name),
         id(id),
         localRef(localRef),
         guid(guid),
-        refType(std::move(refType)){};
+        refType(std::move(refType)),
+        guidKey(guid != nullptr ? ocx::utils::ParseGuid(guid)
+                                : std::nullopt){};
 };
 
 /**
- * Get the meta information of a given DOM element
+ * Get the meta information of a given DOM element. The meta information is
+ * read once per element and kept in a per-thread table, so repeated calls
+ * for the same element neither allocate nor read the attributes again.
  *
  * @param element the element to get the meta information from
  * @return struct holding the meta information or nullptr if LDOM_Element is
- * null
+ * null. The pointer stays valid until ResetOCXMetaCache is called.
+ */
+OCXMeta const *GetOCXMeta(LDOM_Element const &element);
+
+/**
+ * @brief Drop all cached meta information and tag atoms of the document read
+ * with the context bound to the calling thread, or of the calling thread if
+ * no context is bound. Must be called before LDOM documents are released, as
+ * the cache is keyed by the element nodes.
  */
-std::unique_ptr<OCXMeta> GetOCXMeta(LDOM_Element const &element);
+void ResetOCXMetaCache();
 
 std::string GetLocalTagName(LDOM_Element const &elem, bool keepPrefix = false);
 
+/**
+ * Get the interned local tag name of an element. The atom is resolved once
+ * per element and kept in the same per-thread table as the meta information.
+ *
+ * @param elem the element
+ * @return the atom of the local tag name or Atom::Unknown if elem is null
+ */
+ocx::utils::Atom GetLocalTagAtom(LDOM_Element const &elem);
+
 std::string GetLocalAttrName(LDOM_Node const &node);
 
 std::string GetAttrValue(LDOM_Element const &element, std::string const &name);
@@ -94,6 +124,44 @@ std::string GetChildTagName(LDOM_Element const &parent,
 LDOM_Element GetFirstChild(LDOM_Element const &parent,
                            std::string_view localName);
 
+/**
+ * Same as above, but compares the interned local tag names of the children
+ * without building any strings. Once a parent with many children is looked up
+ * a second time, an index of its children is built, so further lookups are
+ * constant time.
+ */
+LDOM_Element GetFirstChild(LDOM_Element const &parent,
+                           ocx::utils::Atom localName);
+
+/**
+ * @brief Call the callback for each child element with the given local name
+ * in document order. Uses the same child index as GetFirstChild, so the
+ * callback must not call ResetOCXMetaCache.
+ *
+ * @param parent the parent element
+ * @param localName the local tag name of the children
+ * @param callback called for each matching child
+ */
+void ForEachChild(LDOM_Element const &parent, ocx::utils::Atom localName,
+                  std::function<void(LDOM_Element const &)> const &callback);
+
+/**
+ * Build the child index of a parent element right away, regardless of the
+ * number of its children. Worth it for parents many different children are
+ * looked up in.
+ */
+void IndexChildren(LDOM_Element const &parent);
+
+/**
+ * @brief Adapt a reader function returning a derived shape type, e.g.
+ * TopoDS_Face, to return a TopoDS_Shape, so the readers of different element
+ * types can share one ocx::utils::AtomMap
+ */
+template <auto Read>
+TopoDS_Shape ReadAsShape(LDOM_Element const &elementN) {
+  return Read(elementN);
+}
+
 /**
  * @brief Get the integer attribute value from an attribute. If the attribute is
  * missing the value is not touched
@@ -117,6 +185,23 @@ void GetIntegerAttribute(LDOM_Element const &elem, std::string const &attrName,
 void GetDoubleAttribute(LDOM_Element const &elem, std::string const &attrName,
                         Standard_Real &value);
 
+/**
+ * @brief Same as above, but takes the attribute name as LDOMString, so hot
+ * paths can create the name once instead of on every call
+ */
+void GetDoubleAttribute(LDOM_Element const &elem, LDOMString const &attrName,
+                        Standard_Real &value);
+
+/**
+ * @brief Match a text against a glob pattern supporting the wildcards '*'
+ * (any sequence of characters) and '?' (any single character)
+ *
+ * @param pattern the glob pattern
+ * @param text the text to match
+ * @return true if the complete text matches the pattern
+ */
+bool GlobMatch(std::string_view pattern, std::string_view text);
+
 gp_Pnt ReadPoint(LDOM_Element const &pointN);
 
 gp_Dir ReadDirection(LDOM_Element const &dirN);
@@ -171,7 +256,9 @@ TopoDS_Shape LimitShapeByWire(TopoDS_Shape const &shape,
                               std::string_view guid);
 
 /**
- * Compute the 3D intersection between a two surfaces
+ * Compute the 3D intersection between a two surfaces. Two planes give an
+ * infinite line, B-spline and Bezier surfaces limit the result to their
+ * parameter domain, the line of a planar patch to the box of the patch.
  * @returns nullopt if there is no intersection or the Algorithm fails, the 3D
  * curve else
  */
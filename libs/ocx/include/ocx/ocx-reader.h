@@ -34,7 +34,9 @@ class OCXReader {
   ~OCXReader() = default;
 
   /*
-   * Combination of ReadFile and Transfer
+   * Combination of ReadFile and Transfer. Each call reads into a context of
+   * its own, so several files may be read one after another or concurrently
+   * from different threads.
    */
   static Standard_EXPORT Standard_Boolean
   Perform(Standard_CString filename, Handle(TDocStd_Document) doc,
@@ -46,7 +48,7 @@ class OCXReader {
    * Translate OCX file given by filename into the document
    * Return True if succeeded, and False in case of fail
    * @param filename the file to read
-   * @param ctx the context to use
+   * @param ctx set to the context created for the document
    * @return true if result is usable for Transfer
    */
   static Standard_EXPORT Standard_Boolean
@@ -55,12 +57,14 @@ class OCXReader {
   /**
    * Parsed the document model into OCAF
    *
+   * @param ctx the context of the document, bound to the calling thread while
+   * parsing
    * @param doc the target model
    * @param theProgress progress
    * @return true if result could be used.
    */
   static Standard_EXPORT Standard_Boolean
-  Parse(Handle(TDocStd_Document) & doc,
+  Parse(std::shared_ptr<OCXContext> const &ctx, Handle(TDocStd_Document) & doc,
         Message_ProgressRange const &theProgress = Message_ProgressRange());
 };
 
@@ -19,10 +19,20 @@
 // The following lines pull in the real ocx*.cc files.
 
 // General
+#include "src/ocx-atom.cc"
 #include "src/ocx-context.cc"
+#include "src/ocx-decompress.cc"
+#include "src/ocx-guid.cc"
 #include "src/ocx-helper.cc"
 #include "src/ocx-log.cc"
+#include "src/ocx-mapped-file.cc"
+#include "src/ocx-numeric.cc"
+#include "src/ocx-ocaf-journal.cc"
+#include "src/ocx-panel-index.cc"
+#include "src/ocx-panel-stream.cc"
+#include "src/ocx-parallel.cc"
 #include "src/ocx-reader.cc"
+#include "src/ocx-task-graph.cc"
 #include "src/ocx-utils.cc"
 
 //-----------------------------------------------------------------------------
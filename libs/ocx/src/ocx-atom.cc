@@ -0,0 +1,100 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-atom.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ocx::utils {
+
+namespace {
+
+class AtomTable {
+ public:
+  AtomTable() {
+#define OCX_REGISTER_ATOM(name) Add(#name);
+    OCX_ATOM_LIST(OCX_REGISTER_ATOM)
+#undef OCX_REGISTER_ATOM
+  }
+
+  Atom Find(std::string_view localName) {
+    std::shared_lock lock(m_mutex);
+    if (auto res = m_atoms.find(localName); res != m_atoms.end()) {
+      return res->second;
+    }
+    return Atom::Unknown;
+  }
+
+  Atom Insert(std::string_view localName) {
+    std::unique_lock lock(m_mutex);
+    if (auto res = m_atoms.find(localName); res != m_atoms.end()) {
+      return res->second;
+    }
+    return Add(localName);
+  }
+
+  std::string_view Name(Atom atom) {
+    std::shared_lock lock(m_mutex);
+    auto const idx = static_cast<std::size_t>(atom);
+    if (idx == 0 || idx > m_names.size()) {
+      return {};
+    }
+    return m_names[idx - 1];
+  }
+
+ private:
+  std::shared_mutex m_mutex;
+  // std::deque keeps the strings in place, the map keys refer to them
+  std::deque<std::string> m_names;
+  std::unordered_map<std::string_view, Atom> m_atoms;
+
+  Atom Add(std::string_view localName) {
+    std::string_view const name = m_names.emplace_back(localName);
+    auto const atom = static_cast<Atom>(m_names.size());
+    m_atoms.emplace(name, atom);
+    return atom;
+  }
+};
+
+AtomTable &GetAtomTable() {
+  static AtomTable table;
+  return table;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+Atom InternAtom(std::string_view localName) {
+  if (localName.empty()) {
+    return Atom::Unknown;
+  }
+
+  AtomTable &table = GetAtomTable();
+  if (Atom atom = table.Find(localName); atom != Atom::Unknown) {
+    return atom;
+  }
+  return table.Insert(localName);
+}
+
+//-----------------------------------------------------------------------------
+
+std::string_view AtomName(Atom atom) { return GetAtomTable().Name(atom); }
+
+}  // namespace ocx::utils
@@ -14,73 +14,102 @@
 
 #include "ocx/ocx-context.h"
 
+#include <BRepBndLib.hxx>
 #include <LDOM_Element.hxx>
+#include <TDataStd_Name.hxx>
 #include <TDocStd_Document.hxx>
 #include <UnitsAPI.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 
 #include "occutils/occutils-shape.h"
 #include "ocx/internal/ocx-bar-section.h"
 #include "ocx/internal/ocx-exceptions.h"
+#include "ocx/internal/ocx-numeric.h"
+#include "ocx/internal/ocx-ocaf-journal.h"
 #include "ocx/internal/ocx-refplane-wrapper.h"
 #include "ocx/ocx-helper.h"
 
+namespace {
+
+/**
+ * Source of the meta cache generations, shared by all contexts. Generation 0
+ * is left for threads without a bound context.
+ */
+std::atomic<std::uint64_t> metaCacheGenerations{1};
+
+}  // namespace
+
 namespace ocx {
 
-bool LDOMCompare::operator()(LDOM_Element const &lhs,
-                             LDOM_Element const &rhs) const {
-  auto metaLhs = ocx::helper::GetOCXMeta(lhs);
-  auto metaRhs = ocx::helper::GetOCXMeta(rhs);
-
-  if (metaLhs->guid != nullptr && metaRhs->guid != nullptr) {
-    return strcmp(metaLhs->guid, metaRhs->guid) < 0;
-  } else if (metaLhs->id != nullptr && metaRhs->id != nullptr) {
-    return strcmp(metaLhs->id, metaRhs->id) < 0;
-  } else if (metaLhs->localRef != nullptr && metaRhs->localRef != nullptr) {
-    return strcmp(metaLhs->localRef, metaRhs->localRef) < 0;
-  } else {
-    return false;
+OCXContext::OCXContext(LDOM_Element const &root, std::string nsPrefix)
+    : m_root(root),
+      m_nsPrefix(std::move(nsPrefix)),
+      m_metaCacheGeneration(metaCacheGenerations++) {}
+
+//-----------------------------------------------------------------------------
+
+thread_local std::shared_ptr<OCXContext> OCXContext::s_current = nullptr;
+
+//-----------------------------------------------------------------------------
+
+std::shared_ptr<OCXContext> OCXContext::Create(LDOM_Element const &root,
+                                               std::string const &nsPrefix) {
+  if (root == nullptr) {
+    throw OCXInitializationFailedException("OCXContext initialization failed");
   }
+  return create(root, nsPrefix);
 }
 
 //-----------------------------------------------------------------------------
 
-OCXContext::OCXContext(LDOM_Element const &root, std::string nsPrefix)
-    : m_root(root), m_nsPrefix(std::move(nsPrefix)) {}
+OCXContext::Scope::Scope(std::shared_ptr<OCXContext> ctx)
+    : m_previous(std::exchange(s_current, std::move(ctx))) {}
 
 //-----------------------------------------------------------------------------
 
-std::shared_ptr<OCXContext> OCXContext::s_instance = nullptr;
+OCXContext::Scope::~Scope() { s_current = std::move(m_previous); }
 
 //-----------------------------------------------------------------------------
 
 void OCXContext::Initialize(LDOM_Element const &root,
                             std::string const &nsPrefix) {
-  if (s_instance == nullptr) {
-    if (root != nullptr) {
-      s_instance = create(root, nsPrefix);
-    } else {
-      throw OCXInitializationFailedException(
-          "OCXContext initialization failed");
-    }
-  } else {
-    OCX_ERROR("OCXContext already initialized")
+  s_current = Create(root, nsPrefix);
+}
+
+//-----------------------------------------------------------------------------
+
+OCXContext *OCXContext::GetInstance() {
+  if (s_current == nullptr) {
+    throw OCXNotFoundException("OCXContext not initialized");
   }
+  return s_current.get();
 }
 
 //-----------------------------------------------------------------------------
 
-std::shared_ptr<OCXContext> OCXContext::GetInstance() {
-  if (s_instance == nullptr) {
+std::shared_ptr<OCXContext> OCXContext::GetShared() {
+  if (s_current == nullptr) {
     throw OCXNotFoundException("OCXContext not initialized");
   }
-  return s_instance;
+  return s_current;
 }
 
 //-----------------------------------------------------------------------------
 
+OCXContext *OCXContext::Current() { return s_current.get(); }
+
+//-----------------------------------------------------------------------------
+
 LDOM_Element OCXContext::OCXRoot() const { return m_root; }
 
 //-----------------------------------------------------------------------------
@@ -92,22 +121,27 @@ std::string OCXContext::Prefix() const { return m_nsPrefix; }
 void OCXContext::PrepareUnits() {
   OCX_INFO("Setting up units...")
 
-  // Set main unit
-  UnitsAPI::SetLocalSystem(UnitsAPI_SI);
+  // Set main unit. The unit system is global, so it is set only once for all
+  // contexts.
+  static std::once_flag unitSystemSet;
+  std::call_once(unitSystemSet,
+                 []() { UnitsAPI::SetLocalSystem(UnitsAPI_SI); });
 
   // Set defaults
-  unit2factor["Um"] = 1;
-  unit2factor["Udm"] = 0.1;
-  unit2factor["Ucm"] = 0.01;
-  unit2factor["Umm"] = 0.001;
+  unit2LengthUnit["Um"] = ocx::utils::LengthUnit::M;
+  unit2LengthUnit["Udm"] = ocx::utils::LengthUnit::Dm;
+  unit2LengthUnit["Ucm"] = ocx::utils::LengthUnit::Cm;
+  unit2LengthUnit["Umm"] = ocx::utils::LengthUnit::Mm;
 
-  LDOM_Element unitsMLN = ocx::helper::GetFirstChild(m_root, "UnitsML");
+  LDOM_Element unitsMLN =
+      ocx::helper::GetFirstChild(m_root, ocx::utils::Atom::UnitsML);
   if (unitsMLN.isNull()) {
     OCX_ERROR("No UnitsML node found")
     return;
   }
 
-  LDOM_Node unitsSetN = ocx::helper::GetFirstChild(unitsMLN, "UnitSet");
+  LDOM_Node unitsSetN =
+      ocx::helper::GetFirstChild(unitsMLN, ocx::utils::Atom::UnitSet);
   if (unitsSetN.isNull()) {
     OCX_ERROR("No UnitSet node found in UnitsML")
     return;
@@ -119,7 +153,7 @@ void OCXContext::PrepareUnits() {
     if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
     if (aNodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element unitN = (LDOM_Element &)childN;
-      if (ocx::helper::GetLocalTagName(unitN) == "Unit") {
+      if (ocx::helper::GetLocalTagAtom(unitN) == ocx::utils::Atom::Unit) {
         // Parse unit ID
         std::string unitId = unitN.getAttribute("xml:id").GetString();
         if (unitId.empty()) {
@@ -130,7 +164,7 @@ void OCXContext::PrepareUnits() {
 
         // Parse unit symbol
         LDOM_Element unitSymbolN =
-            ocx::helper::GetFirstChild(unitN, "UnitSymbol");
+            ocx::helper::GetFirstChild(unitN, ocx::utils::Atom::UnitSymbol);
         if (unitSymbolN.isNull()) {
           OCX_ERROR("No UnitSymbol child node found in Unit")
           childN = childN.getNextSibling();
@@ -141,14 +175,9 @@ void OCXContext::PrepareUnits() {
         OCX_INFO("UnitID={}, UnitSymbol={}", unitId, unitSymbol)
 
         // Add unit to map
-        if ("m" == unitSymbol) {
-          unit2factor[unitId] = 1;
-        } else if ("dm" == unitSymbol) {
-          unit2factor[unitId] = 1 / 10.0;
-        } else if ("cm" == unitSymbol) {
-          unit2factor[unitId] = 1 / 100.0;
-        } else if ("mm" == unitSymbol) {
-          unit2factor[unitId] = 1 / 1000.0;
+        if (auto unit = ocx::utils::ParseLengthUnit(unitSymbol);
+            unit != ocx::utils::LengthUnit::Unknown) {
+          unit2LengthUnit[unitId] = unit;
         }
       }
     }
@@ -160,9 +189,9 @@ void OCXContext::PrepareUnits() {
 
 //-----------------------------------------------------------------------------
 
-double OCXContext::LoopupFactor(const std::string &unit) const {
-  if (auto res = unit2factor.find(unit); res != unit2factor.end()) {
-    return res->second;
+double OCXContext::LoopupFactor(std::string_view unit) const {
+  if (auto res = unit2LengthUnit.find(unit); res != unit2LengthUnit.end()) {
+    return ocx::utils::LengthUnitFactor(res->second);
   }
   OCX_INFO("No loopup-factor found for unit {}, using 1.0 instead", unit)
   return 1;
@@ -170,17 +199,104 @@ double OCXContext::LoopupFactor(const std::string &unit) const {
 
 //-----------------------------------------------------------------------------
 
+namespace {
+
+/**
+ * Get the key of an element without a valid GUID in the ID maps, this is the
+ * GUIDRef string if it could not be parsed, the ID or the localRef
+ */
+std::string_view FallbackKey(ocx::helper::OCXMeta const &meta) {
+  if (meta.guid != nullptr && *meta.guid != '\0') {
+    return meta.guid;
+  } else if (meta.id != nullptr && *meta.id != '\0') {
+    return meta.id;
+  } else if (meta.localRef != nullptr) {
+    return meta.localRef;
+  }
+  return {};
+}
+
+}  // namespace
+
 void OCXContext::RegisterShape(LDOM_Element const &element,
                                TopoDS_Shape const &shape) {
-  LDOM2TopoDS_Shape[element] = shape;
+  auto meta = ocx::helper::GetOCXMeta(element);
+
+  RegisteredShape registered{shape, Bnd_Box()};
+  if (!shape.IsNull()) {
+    BRepBndLib::Add(shape, registered.box);
+  }
+
+  if (meta->guidKey) {
+    m_guid2Shape.Insert(*meta->guidKey, registered);
+  } else {
+    m_id2Shape.Insert(FallbackKey(*meta), registered);
+  }
 }
 
 TopoDS_Shape OCXContext::LookupShape(LDOM_Element const &element) {
-  if (auto res = LDOM2TopoDS_Shape.find(element);
-      res != LDOM2TopoDS_Shape.end()) {
+  auto meta = ocx::helper::GetOCXMeta(element);
+
+  auto res = meta->guidKey ? m_guid2Shape.Find(*meta->guidKey)
+                           : m_id2Shape.Find(FallbackKey(*meta));
+  return res.has_value() ? res->shape : TopoDS_Shape();
+}
+
+Bnd_Box OCXContext::LookupShapeBox(LDOM_Element const &element) {
+  auto meta = ocx::helper::GetOCXMeta(element);
+
+  auto res = meta->guidKey ? m_guid2Shape.Find(*meta->guidKey)
+                           : m_id2Shape.Find(FallbackKey(*meta));
+  return res.has_value() ? res->box : Bnd_Box();
+}
+
+void OCXContext::CountSkippedIntersection() { m_skippedIntersections++; }
+
+void OCXContext::CountSkippedCut() { m_skippedCuts++; }
+
+std::size_t OCXContext::SkippedIntersections() const {
+  return m_skippedIntersections.load();
+}
+
+std::size_t OCXContext::SkippedCuts() const { return m_skippedCuts.load(); }
+
+//-----------------------------------------------------------------------------
+
+bool OCXContext::IntersectionKey::operator<(
+    IntersectionKey const &other) const {
+  return std::tie(first.hi, first.lo, second.hi, second.lo, offset) <
+         std::tie(other.first.hi, other.first.lo, other.second.hi,
+                  other.second.lo, other.offset);
+}
+
+OCXContext::IntersectionKey OCXContext::MakeIntersectionKey(
+    ocx::utils::Guid const &first, ocx::utils::Guid const &second,
+    double offset) {
+  // Without offset both surfaces are interchangeable
+  if (offset == 0 && std::tie(second.hi, second.lo) <
+                         std::tie(first.hi, first.lo)) {
+    return {second, first, offset};
+  }
+  return {first, second, offset};
+}
+
+void OCXContext::RegisterIntersection(ocx::utils::Guid const &first,
+                                      ocx::utils::Guid const &second,
+                                      double offset, TopoDS_Edge const &edge) {
+  std::unique_lock lock(m_intersectionsMutex);
+  m_intersections.emplace(MakeIntersectionKey(first, second, offset), edge);
+}
+
+std::optional<TopoDS_Edge> OCXContext::LookupIntersection(
+    ocx::utils::Guid const &first, ocx::utils::Guid const &second,
+    double offset) const {
+  std::shared_lock lock(m_intersectionsMutex);
+  if (auto res =
+          m_intersections.find(MakeIntersectionKey(first, second, offset));
+      res != m_intersections.end()) {
     return res->second;
   }
-  return {};
+  return std::nullopt;
 }
 
 //-----------------------------------------------------------------------------
@@ -189,14 +305,14 @@ void OCXContext::RegisterRefPlane(
     std::string const &guid, ocx::context_entities::RefPlaneType const &type,
     LDOM_Element const &element, gp_Dir const &normal, gp_Pnt const &p0,
     gp_Pnt const &p1, gp_Pnt const &p2) {
-  GUID2RefPlane[guid] = ocx::context_entities::RefPlaneWrapper(
-      guid, type, element, normal, p0, p1, p2);
+  GUID2RefPlane.Insert(guid, ocx::context_entities::RefPlaneWrapper(
+                                guid, type, element, normal, p0, p1, p2));
 }
 
 ocx::context_entities::RefPlaneWrapper OCXContext::LookupRefPlane(
     std::string_view const &guid) {
-  if (auto res = GUID2RefPlane.find(guid); res != GUID2RefPlane.end()) {
-    return res->second;
+  if (auto res = GUID2RefPlane.Find(guid); res.has_value()) {
+    return *res;
   }
   OCX_ERROR("No RefPlane found for given guid {}", guid)
   return {};
@@ -205,14 +321,14 @@ ocx::context_entities::RefPlaneWrapper OCXContext::LookupRefPlane(
 
 void OCXContext::RegisterHoleShape(std::string const &guid,
                                    TopoDS_Shape const &holeShape) {
-  m_holeCatalogue[guid] = holeShape;
+  m_holeCatalogue.Insert(guid, holeShape);
 }
 
 //-----------------------------------------------------------------------------
 
 TopoDS_Shape OCXContext::LookupHoleShape(std::string_view const &guid) {
-  if (auto res = m_holeCatalogue.find(guid); res != m_holeCatalogue.end()) {
-    return res->second;
+  if (auto res = m_holeCatalogue.Find(guid); res.has_value()) {
+    return *res;
   }
   OCX_ERROR("No HoleShape found for given guid {}", guid)
   return {};
@@ -223,11 +339,13 @@ TopoDS_Shape OCXContext::LookupHoleShape(std::string_view const &guid) {
 void OCXContext::RegisterPrincipalParticulars(
     ocx::context_entities::PrincipalParticularsWrapper const
         &PrincipalParticularsWrapper) {
+  std::lock_guard lock(m_entitiesMutex);
   m_principalParticulars = PrincipalParticularsWrapper;
 }
 
 ocx::context_entities::PrincipalParticularsWrapper
 OCXContext::GetPrincipalParticulars() {
+  std::lock_guard lock(m_entitiesMutex);
   return m_principalParticulars;
 }
 
@@ -236,11 +354,13 @@ OCXContext::GetPrincipalParticulars() {
 void OCXContext::RegisterVesselGrid(
     std::vector<ocx::context_entities::VesselGridWrapper> const
         &vesselGridWrappers) {
+  std::lock_guard lock(m_entitiesMutex);
   m_vesselGrid = vesselGridWrappers;
 }
 
 std::vector<ocx::context_entities::VesselGridWrapper>
 OCXContext::GetVesselGrid() {
+  std::lock_guard lock(m_entitiesMutex);
   return m_vesselGrid;
 }
 
@@ -249,13 +369,23 @@ OCXContext::GetVesselGrid() {
 void OCXContext::RegisterBarSection(
     LDOM_Element const &element,
     ocx::context_entities::BarSection const &section) {
-  LDOM2BarSection[element] = section;
+  auto meta = ocx::helper::GetOCXMeta(element);
+
+  if (meta->guidKey) {
+    m_guid2BarSection.Insert(*meta->guidKey, section);
+  } else {
+    m_id2BarSection.Insert(FallbackKey(*meta), section);
+  }
 }
 
 ocx::context_entities::BarSection OCXContext::LookupBarSection(
     LDOM_Element const &element) const {
-  if (auto res = LDOM2BarSection.find(element); res != LDOM2BarSection.end()) {
-    return res->second;
+  auto meta = ocx::helper::GetOCXMeta(element);
+
+  if (auto res = meta->guidKey ? m_guid2BarSection.Find(*meta->guidKey)
+                               : m_id2BarSection.Find(FallbackKey(*meta));
+      res.has_value()) {
+    return *res;
   }
   OCX_ERROR("No Shape found for given LDOM_Element")
   return {};
@@ -263,6 +393,31 @@ ocx::context_entities::BarSection OCXContext::LookupBarSection(
 
 //-----------------------------------------------------------------------------
 
+void OCXContext::RegisterPanelStream(
+    std::shared_ptr<ocx::stream::PanelStream> const &panelStream) {
+  std::lock_guard lock(m_entitiesMutex);
+  m_panelStream = panelStream;
+}
+
+std::shared_ptr<ocx::stream::PanelStream> OCXContext::GetPanelStream() const {
+  std::lock_guard lock(m_entitiesMutex);
+  return m_panelStream;
+}
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t OCXContext::MetaCacheGeneration() const {
+  return m_metaCacheGeneration.load();
+}
+
+//-----------------------------------------------------------------------------
+
+void OCXContext::NextMetaCacheGeneration() {
+  m_metaCacheGeneration = metaCacheGenerations++;
+}
+
+//-----------------------------------------------------------------------------
+
 void OCXContext::OCAFDoc(const opencascade::handle<TDocStd_Document> &handle) {
   ocafDoc = handle;
   ocafShapeTool = XCAFDoc_DocumentTool::ShapeTool(ocafDoc->Main());
@@ -281,4 +436,35 @@ opencascade::handle<XCAFDoc_ColorTool> OCXContext::OCAFColorTool() const {
   return ocafColorTool;
 }
 
+//-----------------------------------------------------------------------------
+
+void OCXContext::AddOCAFShape(TopoDS_Shape const &shape, bool makeAssembly,
+                              std::string const &name,
+                              std::optional<Quantity_Color> const &color,
+                              XCAFDoc_ColorType colorType) {
+  if (OCAFJournal *journal = OCAFJournal::Current(); journal != nullptr) {
+    journal->Record(shape, makeAssembly, name, color, colorType);
+    return;
+  }
+
+  std::lock_guard lock(m_ocafMutex);
+  TDF_Label label = ocafShapeTool->AddShape(shape, makeAssembly);
+  TDataStd_Name::Set(label, name.c_str());
+  if (color.has_value()) {
+    ocafColorTool->SetColor(label, *color, colorType);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+void OCXContext::AddOCAFShapes(OCAFJournal const &journal) {
+  if (OCAFJournal *current = OCAFJournal::Current(); current != nullptr) {
+    current->Append(journal);
+    return;
+  }
+
+  std::lock_guard lock(m_ocafMutex);
+  journal.Replay(ocafShapeTool, ocafColorTool);
+}
+
 }  // namespace ocx
@@ -0,0 +1,329 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-decompress.h"
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ocx/internal/ocx-log.h"
+
+namespace ocx::stream {
+
+Compression DetectCompression(std::istream &is) {
+  std::streampos const pos = is.tellg();
+
+  unsigned char magic[4] = {0, 0, 0, 0};
+  is.read(reinterpret_cast<char *>(magic), sizeof(magic));
+  std::streamsize const numRead = is.gcount();
+
+  is.clear();
+  is.seekg(pos);
+
+  if (numRead >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) {
+    return Compression::Gzip;
+  }
+  if (numRead == 4 && magic[0] == 0x28 && magic[1] == 0xB5 &&
+      magic[2] == 0x2F && magic[3] == 0xFD) {
+    return Compression::Zstd;
+  }
+  return Compression::None;
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Stream buffer handing over the blocks decompressed by the worker thread
+ */
+class DecompressStream::Buffer : public std::streambuf {
+ public:
+  Buffer(std::shared_ptr<std::istream> source, Compression compression);
+  ~Buffer() override;
+
+ protected:
+  int_type underflow() override;
+
+ private:
+  static constexpr std::size_t kInputSize = 1 << 16;
+  static constexpr std::size_t kBlockSize = 1 << 20;
+  static constexpr std::size_t kMaxQueuedBlocks = 4;
+
+  void Run();
+  bool InflateGzip();
+  bool DecompressZstd();
+
+  /**
+   * Read the next chunk of compressed input
+   *
+   * @return the number of bytes read, 0 at the end of the source
+   */
+  std::size_t ReadInput();
+
+  /**
+   * Hand over a decompressed block, blocks while the queue is full
+   *
+   * @return false if the consumer stopped reading
+   */
+  bool Push(std::vector<char> &&block);
+
+  std::shared_ptr<std::istream> m_source;
+  Compression m_compression;
+  std::vector<char> m_input;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::vector<char>> m_queue;
+  bool m_finished = false;
+  bool m_stop = false;
+
+  std::vector<char> m_current;
+  std::thread m_worker;
+};
+
+//-----------------------------------------------------------------------------
+
+DecompressStream::Buffer::Buffer(std::shared_ptr<std::istream> source,
+                                 Compression compression)
+    : m_source(std::move(source)),
+      m_compression(compression),
+      m_input(kInputSize) {
+  m_worker = std::thread(&Buffer::Run, this);
+}
+
+//-----------------------------------------------------------------------------
+
+DecompressStream::Buffer::~Buffer() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  if (m_worker.joinable()) {
+    m_worker.join();
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+DecompressStream::Buffer::int_type DecompressStream::Buffer::underflow() {
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return !m_queue.empty() || m_finished; });
+    if (m_queue.empty()) {
+      return traits_type::eof();
+    }
+    m_current = std::move(m_queue.front());
+    m_queue.pop_front();
+  }
+  m_cv.notify_all();
+
+  setg(m_current.data(), m_current.data(),
+       m_current.data() + m_current.size());
+  return traits_type::to_int_type(*gptr());
+}
+
+//-----------------------------------------------------------------------------
+
+void DecompressStream::Buffer::Run() {
+  switch (m_compression) {
+    case Compression::Gzip:
+      InflateGzip();
+      break;
+    case Compression::Zstd:
+      DecompressZstd();
+      break;
+    case Compression::None:
+      break;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_finished = true;
+  }
+  m_cv.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+
+std::size_t DecompressStream::Buffer::ReadInput() {
+  m_source->read(m_input.data(), static_cast<std::streamsize>(m_input.size()));
+  return static_cast<std::size_t>(m_source->gcount());
+}
+
+//-----------------------------------------------------------------------------
+
+bool DecompressStream::Buffer::Push(std::vector<char> &&block) {
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock,
+              [this] { return m_queue.size() < kMaxQueuedBlocks || m_stop; });
+    if (m_stop) {
+      return false;
+    }
+    m_queue.push_back(std::move(block));
+  }
+  m_cv.notify_all();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DecompressStream::Buffer::InflateGzip() {
+  z_stream zs{};
+  // 15 window bits + 16 to only accept the gzip format
+  if (inflateInit2(&zs, 15 + 16) != Z_OK) {
+    OCX_ERROR("Failed to initialize gzip decompression")
+    return false;
+  }
+
+  bool success = true;
+  bool stopped = false;
+  int ret = Z_OK;
+  std::vector<char> block(kBlockSize);
+  zs.next_out = reinterpret_cast<Bytef *>(block.data());
+  zs.avail_out = static_cast<uInt>(block.size());
+
+  while (success && !stopped) {
+    std::size_t const numRead = ReadInput();
+    if (numRead == 0) break;
+    zs.next_in = reinterpret_cast<Bytef *>(m_input.data());
+    zs.avail_in = static_cast<uInt>(numRead);
+
+    // Drain the input chunk, the output may fill several blocks
+    bool outputFull = false;
+    do {
+      ret = inflate(&zs, Z_NO_FLUSH);
+      if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+        OCX_ERROR("Failed to decompress gzip input: {}",
+                  zs.msg != nullptr ? zs.msg : "unknown error")
+        success = false;
+        break;
+      }
+      // A gzip file may consist of several concatenated members
+      if (ret == Z_STREAM_END && zs.avail_in > 0) {
+        inflateReset(&zs);
+      }
+
+      outputFull = zs.avail_out == 0;
+      if (outputFull) {
+        if (!Push(std::move(block))) {
+          stopped = true;
+          break;
+        }
+        block = std::vector<char>(kBlockSize);
+        zs.next_out = reinterpret_cast<Bytef *>(block.data());
+        zs.avail_out = static_cast<uInt>(block.size());
+      }
+    } while (zs.avail_in > 0 || outputFull);
+  }
+
+  if (success && !stopped) {
+    if (ret != Z_STREAM_END) {
+      OCX_ERROR("Unexpected end of gzip compressed input")
+      success = false;
+    }
+    block.resize(block.size() - zs.avail_out);
+    if (!block.empty()) {
+      Push(std::move(block));
+    }
+  }
+
+  inflateEnd(&zs);
+  return success;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DecompressStream::Buffer::DecompressZstd() {
+  ZSTD_DStream *zds = ZSTD_createDStream();
+  if (zds == nullptr) {
+    OCX_ERROR("Failed to initialize zstd decompression")
+    return false;
+  }
+
+  bool success = true;
+  bool stopped = false;
+  std::size_t ret = 0;
+  std::vector<char> block(kBlockSize);
+  ZSTD_outBuffer out = {block.data(), block.size(), 0};
+
+  while (success && !stopped) {
+    std::size_t const numRead = ReadInput();
+    if (numRead == 0) break;
+    ZSTD_inBuffer in = {m_input.data(), numRead, 0};
+
+    // Drain the input chunk, the output may fill several blocks
+    bool outputFull = false;
+    do {
+      ret = ZSTD_decompressStream(zds, &out, &in);
+      if (ZSTD_isError(ret)) {
+        OCX_ERROR("Failed to decompress zstd input: {}",
+                  ZSTD_getErrorName(ret))
+        success = false;
+        break;
+      }
+
+      outputFull = out.pos == out.size;
+      if (outputFull) {
+        if (!Push(std::move(block))) {
+          stopped = true;
+          break;
+        }
+        block = std::vector<char>(kBlockSize);
+        out = {block.data(), block.size(), 0};
+      }
+    } while (in.pos < in.size || outputFull);
+  }
+
+  if (success && !stopped) {
+    // ret is 0 once a frame is completely decoded and flushed
+    if (ret != 0) {
+      OCX_ERROR("Unexpected end of zstd compressed input")
+      success = false;
+    }
+    block.resize(out.pos);
+    if (!block.empty()) {
+      Push(std::move(block));
+    }
+  }
+
+  ZSTD_freeDStream(zds);
+  return success;
+}
+
+//-----------------------------------------------------------------------------
+
+DecompressStream::DecompressStream(std::shared_ptr<std::istream> source,
+                                   Compression compression)
+    : std::istream(nullptr),
+      m_buffer(std::make_unique<Buffer>(std::move(source), compression)) {
+  rdbuf(m_buffer.get());
+}
+
+//-----------------------------------------------------------------------------
+
+DecompressStream::~DecompressStream() = default;
+
+}  // namespace ocx::stream
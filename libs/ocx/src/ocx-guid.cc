@@ -0,0 +1,59 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-guid.h"
+
+#include <optional>
+#include <string_view>
+
+namespace ocx::utils {
+
+std::optional<Guid> ParseGuid(std::string_view guid) {
+  if (guid.size() >= 2 && guid.front() == '{' && guid.back() == '}') {
+    guid = guid.substr(1, guid.size() - 2);
+  }
+
+  Guid result;
+  int numDigits = 0;
+  for (char const c : guid) {
+    if (c == '-') continue;
+
+    std::uint64_t digit;
+    if (c >= '0' && c <= '9') {
+      digit = static_cast<std::uint64_t>(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      digit = static_cast<std::uint64_t>(c - 'a' + 10);
+    } else if (c >= 'A' && c <= 'F') {
+      digit = static_cast<std::uint64_t>(c - 'A' + 10);
+    } else {
+      return std::nullopt;
+    }
+
+    if (numDigits < 16) {
+      result.hi = (result.hi << 4) | digit;
+    } else if (numDigits < 32) {
+      result.lo = (result.lo << 4) | digit;
+    } else {
+      return std::nullopt;
+    }
+    numDigits++;
+  }
+
+  if (numDigits != 32) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+}  // namespace ocx::utils
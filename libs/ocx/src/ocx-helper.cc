@@ -17,31 +17,153 @@
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
+#include <BndLib_AddSurface.hxx>
+#include <GeomAPI_IntCS.hxx>
 #include <GeomAPI_IntSS.hxx>
 #include <GeomAdaptor_Surface.hxx>
+#include <GeomLib_IsPlanarSurface.hxx>
+#include <Geom_Plane.hxx>
 #include <Geom_TrimmedCurve.hxx>
+#include <IntAna_QuadQuadGeo.hxx>
+#include <Precision.hxx>
 #include <ShapeFix_Face.hxx>
 #include <ShapeFix_Shell.hxx>
 #include <TColStd_Array2OfReal.hxx>
 #include <TColgp_Array2OfPnt.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <gp.hxx>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
-#include "occutils/occutils-face.h"
 #include "occutils/occutils-shape-components.h"
 #include "occutils/occutils-step-export.h"
 #include "occutils/occutils-surface.h"
+#include "ocx/internal/ocx-numeric.h"
 #include "ocx/internal/ocx-utils.h"
 #include "ocx/ocx-context.h"
 
 namespace ocx::helper {
 
-std::unique_ptr<OCXMeta> GetOCXMeta(LDOM_Element const &element) {
+namespace {
+
+/**
+ * Gives access to the node an LDOM_Node handle refers to, which identifies
+ * the element independent of the handle instance
+ */
+struct NodeOrigin : LDOM_Node {
+  static LDOM_BasicNode const *Get(LDOM_Node const &node) {
+    return &(node.*(&NodeOrigin::Origin))();
+  }
+};
+
+/**
+ * Index of the element children of a parent element. The children are kept
+ * in document order, each one links to the next child with the same atom.
+ */
+struct ChildIndex {
+  static constexpr std::uint32_t npos = UINT32_MAX;
+
+  // Parents with fewer element children are not indexed, scanning them is
+  // cheap enough
+  static constexpr std::size_t minChildren = 16;
+
+  bool built = false;
+  std::vector<LDOM_Element> children;
+  std::vector<std::uint32_t> next;
+  // First child per atom, sorted by atom
+  std::vector<std::pair<ocx::utils::Atom, std::uint32_t>> first;
+
+  [[nodiscard]] std::uint32_t First(ocx::utils::Atom atom) const {
+    auto res = std::lower_bound(
+        first.begin(), first.end(), atom,
+        [](auto const &entry, ocx::utils::Atom a) { return entry.first < a; });
+    if (res != first.end() && res->first == atom) {
+      return res->second;
+    }
+    return npos;
+  }
+};
+
+struct OCXMetaCache {
+  std::uint64_t generation = 0;
+  std::unordered_map<LDOM_BasicNode const *, OCXMeta> entries;
+  std::unordered_map<LDOM_BasicNode const *, ocx::utils::Atom> atoms;
+  std::unordered_map<LDOM_BasicNode const *, ChildIndex> children;
+};
+
+thread_local OCXMetaCache metaCache;
+
+void ClearMetaCache(std::uint64_t generation) {
+  metaCache.entries.clear();
+  metaCache.atoms.clear();
+  metaCache.children.clear();
+  metaCache.generation = generation;
+}
+
+/**
+ * Get the table of the calling thread, cleared if it belongs to another
+ * context or to an outdated generation of the bound context
+ */
+OCXMetaCache &GetMetaCache() {
+  OCXContext const *ctx = OCXContext::Current();
+  if (std::uint64_t const generation =
+          ctx != nullptr ? ctx->MetaCacheGeneration() : 0;
+      metaCache.generation != generation) {
+    ClearMetaCache(generation);
+  }
+  return metaCache;
+}
+
+/**
+ * Get the child index of a parent element. Only parents with at least
+ * ChildIndex::minChildren element children get an entry, on their first
+ * lookup. The index is built on the second one. Other lookups scan the
+ * siblings instead and do not allocate.
+ *
+ * @param parent the parent element
+ * @param force build the index right away, regardless of the number of
+ * children
+ * @return the index or nullptr if not (yet) built
+ */
+ChildIndex const *GetChildIndex(LDOM_Element const &parent,
+                                bool force = false);
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+void ResetOCXMetaCache() {
+  if (OCXContext *ctx = OCXContext::Current(); ctx != nullptr) {
+    ctx->NextMetaCacheGeneration();
+  } else {
+    ClearMetaCache(0);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+OCXMeta const *GetOCXMeta(LDOM_Element const &element) {
   if (element.isNull()) return nullptr;
 
+  OCXMetaCache &cache = GetMetaCache();
+
+  LDOM_BasicNode const *node = NodeOrigin::Get(element);
+  if (auto res = cache.entries.find(node); res != cache.entries.end()) {
+    return &res->second;
+  }
+
+  // The attribute strings are owned by the LDOM document, only refType is
+  // copied to strip the namespace prefix
   char const *name = element.getAttribute("name").GetString();
 
   char const *id = element.getAttribute("id").GetString();
@@ -57,7 +179,9 @@ std::unique_ptr<OCXMeta> GetOCXMeta(LDOM_Element const &element) {
     }
   }
 
-  return std::make_unique<OCXMeta>(name, id, localRef, guid, refType);
+  return &cache.entries
+              .try_emplace(node, name, id, localRef, guid, std::move(refType))
+              .first->second;
 }
 
 //-----------------------------------------------------------------------------
@@ -73,6 +197,94 @@ std::string GetLocalTagName(LDOM_Element const &elem, bool keepPrefix) {
 
 //-----------------------------------------------------------------------------
 
+ocx::utils::Atom GetLocalTagAtom(LDOM_Element const &elem) {
+  if (elem.isNull()) return ocx::utils::Atom::Unknown;
+
+  OCXMetaCache &cache = GetMetaCache();
+
+  LDOM_BasicNode const *node = NodeOrigin::Get(elem);
+  if (auto res = cache.atoms.find(node); res != cache.atoms.end()) {
+    return res->second;
+  }
+
+  LDOMString const aTagName = elem.getTagName();
+  std::string_view tagName = aTagName.GetString();
+  if (std::size_t idx = tagName.find(':'); idx != std::string_view::npos) {
+    tagName.remove_prefix(idx + 1);
+  }
+
+  ocx::utils::Atom const atom = ocx::utils::InternAtom(tagName);
+  cache.atoms.emplace(node, atom);
+  return atom;
+}
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+ChildIndex const *GetChildIndex(LDOM_Element const &parent, bool force) {
+  auto &indices = GetMetaCache().children;
+  LDOM_BasicNode const *node = NodeOrigin::Get(parent);
+  auto entry = indices.find(node);
+  if (entry == indices.end()) {
+    if (!force) {
+      // Count the children only as far as needed, small parents are scanned
+      std::size_t numChildren = 0;
+      for (LDOM_Node aChildNode = parent.getFirstChild();
+           aChildNode != nullptr && numChildren < ChildIndex::minChildren;
+           aChildNode = aChildNode.getNextSibling()) {
+        const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
+        if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
+        if (aNodeType == LDOM_Node::ELEMENT_NODE) numChildren++;
+      }
+      if (numChildren >= ChildIndex::minChildren) {
+        // First lookup, the index is built on the next one
+        indices.emplace(node, ChildIndex{});
+      }
+      return nullptr;
+    }
+    entry = indices.emplace(node, ChildIndex{}).first;
+  }
+
+  ChildIndex &index = entry->second;
+  if (index.built) {
+    return &index;
+  }
+
+  LDOM_Node aChildNode = parent.getFirstChild();
+  while (aChildNode != nullptr) {
+    const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
+    if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
+    if (aNodeType == LDOM_Node::ELEMENT_NODE) {
+      index.children.push_back((LDOM_Element &)aChildNode);
+    }
+    aChildNode = aChildNode.getNextSibling();
+  }
+
+  // Link the children back to front, so each first entry ends up pointing
+  // to the first child with that atom
+  std::unordered_map<ocx::utils::Atom, std::uint32_t> following;
+  index.next.assign(index.children.size(), ChildIndex::npos);
+  for (auto i = static_cast<std::uint32_t>(index.children.size()); i-- > 0;) {
+    ocx::utils::Atom const atom = GetLocalTagAtom(index.children[i]);
+    if (auto res = following.find(atom); res != following.end()) {
+      index.next[i] = res->second;
+      res->second = i;
+    } else {
+      following.emplace(atom, i);
+    }
+  }
+  index.first.assign(following.begin(), following.end());
+  std::sort(index.first.begin(), index.first.end());
+
+  index.built = true;
+  return &index;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 std::string GetLocalAttrName(LDOM_Node const &elem) {
   auto tagName = std::string(elem.getNodeName().GetString());
   if (std::size_t idx = tagName.find(':'); idx != std::string::npos) {
@@ -115,6 +327,23 @@ LDOM_Element GetFirstChild(LDOM_Element const &parent,
     return {};
   }
 
+  return GetFirstChild(parent, ocx::utils::InternAtom(localName));
+}
+
+LDOM_Element GetFirstChild(LDOM_Element const &parent,
+                           ocx::utils::Atom localName) {
+  // Verify preconditions
+  if (parent == nullptr || localName == ocx::utils::Atom::Unknown) {
+    return {};
+  }
+
+  if (ChildIndex const *index = GetChildIndex(parent); index != nullptr) {
+    if (std::uint32_t idx = index->First(localName); idx != ChildIndex::npos) {
+      return index->children[idx];
+    }
+    return {};
+  }
+
   // Take the first child. If it doesn't match look for other ones in a loop
   LDOM_Node aChildNode = parent.getFirstChild();
   while (aChildNode != nullptr) {
@@ -122,7 +351,7 @@ LDOM_Element GetFirstChild(LDOM_Element const &parent,
         aNodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element aNextElement = (LDOM_Element &)aChildNode;
 
-      if (localName == GetLocalTagName(aNextElement)) {
+      if (localName == GetLocalTagAtom(aNextElement)) {
         return aNextElement;
       }
     }
@@ -133,6 +362,45 @@ LDOM_Element GetFirstChild(LDOM_Element const &parent,
 
 //-----------------------------------------------------------------------------
 
+void ForEachChild(LDOM_Element const &parent, ocx::utils::Atom localName,
+                  std::function<void(LDOM_Element const &)> const &callback) {
+  if (parent == nullptr || localName == ocx::utils::Atom::Unknown) {
+    return;
+  }
+
+  if (ChildIndex const *index = GetChildIndex(parent); index != nullptr) {
+    for (std::uint32_t idx = index->First(localName); idx != ChildIndex::npos;
+         idx = index->next[idx]) {
+      callback(index->children[idx]);
+    }
+    return;
+  }
+
+  LDOM_Node aChildNode = parent.getFirstChild();
+  while (aChildNode != nullptr) {
+    const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
+    if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
+    if (aNodeType == LDOM_Node::ELEMENT_NODE) {
+      LDOM_Element aElement = (LDOM_Element &)aChildNode;
+
+      if (localName == GetLocalTagAtom(aElement)) {
+        callback(aElement);
+      }
+    }
+    aChildNode = aChildNode.getNextSibling();
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+void IndexChildren(LDOM_Element const &parent) {
+  if (parent != nullptr) {
+    (void)GetChildIndex(parent, true);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
 void GetIntegerAttribute(LDOM_Element const &elem, std::string const &attrName,
                          Standard_Integer &value) {
   LDOMString stringValue = elem.getAttribute(attrName.c_str());
@@ -152,41 +420,79 @@ void GetIntegerAttribute(LDOM_Element const &elem, std::string const &attrName,
 
 void GetDoubleAttribute(LDOM_Element const &elem, std::string const &attrName,
                         Standard_Real &value) {
-  LDOMString stringValue = elem.getAttribute(attrName.c_str());
-  if (stringValue.Type() == LDOMBasicString::StringType::LDOM_NULL) {
-    return;
-  }
+  GetDoubleAttribute(elem, LDOMString(attrName.c_str()), value);
+}
 
-  if (strlen(stringValue.GetString()) > 0) {
-    value = Standard_Real(strtod(stringValue.GetString(), nullptr));
-    return;
+void GetDoubleAttribute(LDOM_Element const &elem, LDOMString const &attrName,
+                        Standard_Real &value) {
+  LDOMString const stringValue = elem.getAttribute(attrName);
+  switch (stringValue.Type()) {
+    case LDOMBasicString::StringType::LDOM_NULL:
+      return;
+    case LDOMBasicString::StringType::LDOM_Integer: {
+      Standard_Integer i;
+      if (stringValue.GetInteger(i)) {
+        value = Standard_Real(i);
+      }
+      return;
+    }
+    default:
+      if (!ocx::utils::ParseDouble(stringValue.GetString(), value)) {
+        OCX_WARN("Failed to parse attribute {}=\"{}\" as number",
+                 attrName.GetString(), stringValue.GetString())
+      }
   }
+}
+
+//-----------------------------------------------------------------------------
 
-  int i;
-  stringValue.GetInteger(i);
-  value = Standard_Real((double)i);
+bool GlobMatch(std::string_view pattern, std::string_view text) {
+  std::size_t p = 0;
+  std::size_t t = 0;
+  // Position of the last '*' in the pattern and the text position it matched
+  std::size_t starP = std::string_view::npos;
+  std::size_t starT = 0;
+
+  while (t < text.size()) {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t])) {
+      p++;
+      t++;
+    } else if (p < pattern.size() && pattern[p] == '*') {
+      starP = p++;
+      starT = t;
+    } else if (starP != std::string_view::npos) {
+      // Let the last '*' consume one more character
+      p = starP + 1;
+      t = ++starT;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*') {
+    p++;
+  }
+  return p == pattern.size();
 }
 
 //-----------------------------------------------------------------------------
 
 double ReadDimension(LDOM_Element const &valueN) {
+  static LDOMString const numericValueAttr("numericvalue");
+  static LDOMString const unitAttr("unit");
+
   double value = 0;
-  GetDoubleAttribute(valueN, "numericvalue", value);
-  auto xUnit = std::string(valueN.getAttribute("unit").GetString());
-  value *= OCXContext::GetInstance()->LoopupFactor(xUnit);
+  GetDoubleAttribute(valueN, numericValueAttr, value);
+  LDOMString const unit = valueN.getAttribute(unitAttr);
+  value *= OCXContext::GetInstance()->LoopupFactor(unit.GetString());
   return value;
 }
 
 //-----------------------------------------------------------------------------
 
 gp_Pnt ReadPoint(LDOM_Element const &pointN) {
-  auto xT = LDOMString("ocx:X");
-  auto yT = LDOMString("ocx:Y");
-  auto zT = LDOMString("ocx:Z");
-
-  LDOM_Element xN = pointN.GetChildByTagName(xT);
-  LDOM_Element yN = pointN.GetChildByTagName(yT);
-  LDOM_Element zN = pointN.GetChildByTagName(zT);
+  LDOM_Element xN = GetFirstChild(pointN, ocx::utils::Atom::X);
+  LDOM_Element yN = GetFirstChild(pointN, ocx::utils::Atom::Y);
+  LDOM_Element zN = GetFirstChild(pointN, ocx::utils::Atom::Z);
 
   double x = ReadDimension(xN);
   double y = ReadDimension(yN);
@@ -200,19 +506,21 @@ gp_Pnt ReadPoint(LDOM_Element const &pointN) {
 gp_Trsf ReadTransformation(LDOM_Element transfEle) {
   gp_Trsf localToGlobalTrsf;
 
-  LDOM_Element originEle = GetFirstChild(transfEle, "Origin");
+  LDOM_Element originEle = GetFirstChild(transfEle, ocx::utils::Atom::Origin);
   if (!originEle.isNull()) {
     // Origin Point
     gp_Pnt point = ReadPoint(originEle);
     // Primary Axis Direction Vector
-    LDOM_Element primaryAxisEle = GetFirstChild(transfEle, "PrimaryAxis");
+    LDOM_Element primaryAxisEle =
+        GetFirstChild(transfEle, ocx::utils::Atom::PrimaryAxis);
     gp_Dir primAxis;
     if (!primaryAxisEle.isNull()) {
       primAxis = ReadDirection(primaryAxisEle);
     }
 
     // Secondary Axis Direction Vector
-    LDOM_Element secondaryAxisEle = GetFirstChild(transfEle, "SecondaryAxis");
+    LDOM_Element secondaryAxisEle =
+        GetFirstChild(transfEle, ocx::utils::Atom::SecondaryAxis);
     gp_Dir secondaryAxis;
     if (!secondaryAxisEle.isNull()) {
       secondaryAxis = ReadDirection(secondaryAxisEle);
@@ -239,12 +547,16 @@ gp_Trsf ReadTransformation(LDOM_Element transfEle) {
 //-----------------------------------------------------------------------------
 
 gp_Dir ReadDirection(const LDOM_Element &dirN) {
+  static LDOMString const xAttr("x");
+  static LDOMString const yAttr("y");
+  static LDOMString const zAttr("z");
+
   double x = 0;
-  GetDoubleAttribute(dirN, "x", x);
+  GetDoubleAttribute(dirN, xAttr, x);
   double y = 0;
-  GetDoubleAttribute(dirN, "y", y);
+  GetDoubleAttribute(dirN, yAttr, y);
   double z = 0;
-  GetDoubleAttribute(dirN, "z", z);
+  GetDoubleAttribute(dirN, zAttr, z);
 
   return {x, y, z};
 }
@@ -254,56 +566,68 @@ gp_Dir ReadDirection(const LDOM_Element &dirN) {
 KnotMults ParseKnotVector(std::string_view knotVectorS, int const &numKnots) {
   auto kn = KnotMults();
 
-  std::vector<std::string> out;
-  ocx::utils::Tokenize(knotVectorS, out);
-
-  if (numKnots != out.size()) {
-    OCX_ERROR(
-        "Knot vector size mismatch. Expected {} knot values when parsing [{}], "
-        "but got {}",
-        numKnots, knotVectorS, out.size())
+  if (numKnots < 1) {
+    OCX_ERROR("Invalid number of knots {} when parsing [{}]", numKnots,
+              knotVectorS)
     kn.IsNull = true;
     return kn;
   }
 
-  // Parse the knot values under consideration of multiplicity
-  std::vector<double> knots0;
-  std::vector<int> mults0;
-  // Get the quantity of knots and their multiplicities values
-  double lastKnot{};
-  int mult{};
-  for (int i = 0; i < out.size(); i++) {
-    double knotValue = std::stod(out[i]);
-    // First knot value
-    if (i == 0) {
-      lastKnot = knotValue;
-      mult = 1;
+  // There are at most numKnots distinct knots, so fill the arrays in place
+  // and shrink them once the multiplicities are known
+  kn.knots.Resize(1, numKnots, false);
+  kn.mults.Resize(1, numKnots, false);
+
+  auto const isSpace = [](char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  };
+
+  int numValues = 0;
+  int numUnique = 0;
+  std::size_t pos = 0;
+  while (pos < knotVectorS.size()) {
+    if (isSpace(knotVectorS[pos])) {
+      pos++;
       continue;
     }
+    std::size_t end = pos;
+    while (end < knotVectorS.size() && !isSpace(knotVectorS[end])) end++;
+    std::string_view const token = knotVectorS.substr(pos, end - pos);
+    pos = end;
+
+    // Keep counting to report the actual number of values on a mismatch
+    if (++numValues > numKnots) continue;
+
+    double knotValue;
+    if (!ocx::utils::ParseDouble(token, knotValue)) {
+      OCX_ERROR("Invalid knot value {} when parsing [{}]", token, knotVectorS)
+      kn.IsNull = true;
+      return kn;
+    }
+
     // Increase multiplicity if knot value is nearly the same as the last one
-    if (abs(knotValue - lastKnot) < 1e-9) {
-      mult++;
-      // Don't forget to push, if it's the last knot value
-      if (i == out.size() - 1) {
-        knots0.push_back(knotValue);
-        mults0.push_back(mult);
-      }
+    if (numUnique > 0 &&
+        std::abs(knotValue - kn.knots.Value(numUnique)) < 1e-9) {
+      kn.mults.ChangeValue(numUnique)++;
     } else {
-      knots0.push_back(lastKnot);
-      mults0.push_back(mult);
-      lastKnot = knotValue;
-      mult = 1;
+      numUnique++;
+      kn.knots.SetValue(numUnique, knotValue);
+      kn.mults.SetValue(numUnique, 1);
     }
   }
 
-  // Resize the knot and multiplicity arrays to the needed size
-  kn.knots.Resize(1, (int)knots0.size(), false);
-  kn.mults.Resize(1, (int)mults0.size(), false);
+  if (numKnots != numValues) {
+    OCX_ERROR(
+        "Knot vector size mismatch. Expected {} knot values when parsing [{}], "
+        "but got {}",
+        numKnots, knotVectorS, numValues)
+    kn.IsNull = true;
+    return kn;
+  }
 
-  // Set the knot and multiplicity values
-  for (int i = 0; i < knots0.size(); i++) {
-    kn.knots.SetValue(i + 1, knots0[i]);
-    kn.mults.SetValue(i + 1, mults0[i]);
+  if (numUnique < numKnots) {
+    kn.knots.Resize(1, numUnique, true);
+    kn.mults.Resize(1, numUnique, true);
   }
 
   return kn;
@@ -311,55 +635,138 @@ KnotMults ParseKnotVector(std::string_view knotVectorS, int const &numKnots) {
 
 //-----------------------------------------------------------------------------
 
-PolesWeightsCurve ParseControlPointsCurve(LDOM_Element const &controlPtListN,
-                                          int const &numCtrlPoints) {
-  auto polesWeights = PolesWeightsCurve(numCtrlPoints);
-
+namespace {
+
+/**
+ * Caches the factor of the last unit id, as all coordinates of a ControlPtList
+ * usually share the same unit
+ */
+struct UnitFactorCache {
+  std::string_view unit;
+  double factor = 1;
+  bool valid = false;
+
+  double Get(std::string_view unitId) {
+    if (!valid || unitId != unit) {
+      // The unit id points into the LDOM document which outlives the cache
+      unit = unitId;
+      factor = OCXContext::GetInstance()->LoopupFactor(unitId);
+      valid = true;
+    }
+    return factor;
+  }
+};
+
+/**
+ * @brief Decode a ControlPtList in a single pass, writing the poles and weights
+ * into contiguous storage in document order
+ *
+ * @param controlPtListN the ControlPtList element
+ * @param numCtrlPoints the expected number of control points
+ * @param poles storage for numCtrlPoints poles
+ * @param weights storage for numCtrlPoints weights
+ * @return true if exactly numCtrlPoints control points have been decoded
+ */
+bool DecodeControlPtList(LDOM_Element const &controlPtListN, int numCtrlPoints,
+                         gp_Pnt *poles, Standard_Real *weights) {
+  static LDOMString const weightAttr("weight");
+  static LDOMString const numericValueAttr("numericvalue");
+  static LDOMString const unitAttr("unit");
+
+  UnitFactorCache unitFactors;
+
+  int i = 0;
   LDOM_Node childN = controlPtListN.getFirstChild();
   if (childN.isNull()) {
     OCX_ERROR("No child node found in given ControlPointList element")
-    polesWeights.IsNull = true;
-    return polesWeights;
+    return false;
   }
 
-  int i = 1;  // index starts at 1
-  while (childN != nullptr) {
+  for (; childN != nullptr; childN = childN.getNextSibling()) {
     // Check for valid node type
     const LDOM_Node::NodeType nodeType = childN.getNodeType();
+    if (nodeType == LDOM_Node::ATTRIBUTE_NODE) break;
     if (nodeType != LDOM_Node::ELEMENT_NODE) {
       OCX_ERROR(
           "Invalid node type found in ControlPointList element. Got {}, but"
           "expected {}",
           nodeType, LDOM_Node::ELEMENT_NODE)
-      polesWeights.IsNull = true;
-      return polesWeights;
+      return false;
+    }
+
+    if (i == numCtrlPoints) {
+      OCX_ERROR("More than {} control points found in ControlPointList",
+                numCtrlPoints)
+      return false;
     }
 
     // Parse the control point
-    LDOM_Element controlPointN = (LDOM_Element &)childN;
-    LDOM_Element pointN = GetFirstChild(controlPointN, "Point3D");
+    LDOM_Element pointN =
+        GetFirstChild((LDOM_Element &)childN, ocx::utils::Atom::Point3D);
     if (pointN.isNull()) {
       OCX_ERROR("No Point3D child node found in given ControlPoint element")
-      polesWeights.IsNull = true;
-      return polesWeights;
+      return false;
     }
 
-    // Read the point
-    polesWeights.poles.SetValue(i, ReadPoint(pointN));
+    // Read the coordinates in a single pass over the Point3D children
+    double xyz[3] = {0, 0, 0};
+    for (LDOM_Node coordN = pointN.getFirstChild(); coordN != nullptr;
+         coordN = coordN.getNextSibling()) {
+      const LDOM_Node::NodeType coordType = coordN.getNodeType();
+      if (coordType == LDOM_Node::ATTRIBUTE_NODE) break;
+      if (coordType != LDOM_Node::ELEMENT_NODE) continue;
+
+      LDOM_Element const &coordE = (LDOM_Element &)coordN;
+      int axis;
+      switch (GetLocalTagAtom(coordE)) {
+        case ocx::utils::Atom::X:
+          axis = 0;
+          break;
+        case ocx::utils::Atom::Y:
+          axis = 1;
+          break;
+        case ocx::utils::Atom::Z:
+          axis = 2;
+          break;
+        default:
+          continue;
+      }
+
+      double value = 0;
+      GetDoubleAttribute(coordE, numericValueAttr, value);
+      LDOMString const unit = coordE.getAttribute(unitAttr);
+      xyz[axis] = value * unitFactors.Get(unit.GetString());
+    }
+    poles[i].SetCoord(xyz[0], xyz[1], xyz[2]);
 
     // Read the weight
     double weight = 1.0;  // default weight
-    GetDoubleAttribute(pointN, "weight", weight);
-    polesWeights.weights.SetValue(i, weight);
+    GetDoubleAttribute(pointN, weightAttr, weight);
+    weights[i] = weight;
 
-    childN = controlPointN.getNextSibling();
     i++;
   }
 
-  //  for ( int i = 1; i <= polesWeights.poles.Size();i++) {
-  //    gp_Pnt point = polesWeights.poles.Value(i);
-  //      OCX_INFO("pole #{} [{}, {}, {}]", i, point.X(), point.Y(), point.Z());
-  //  }
+  if (i != numCtrlPoints) {
+    OCX_ERROR("Expected {} control points in ControlPointList, but found {}",
+              numCtrlPoints, i)
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+PolesWeightsCurve ParseControlPointsCurve(LDOM_Element const &controlPtListN,
+                                          int const &numCtrlPoints) {
+  auto polesWeights = PolesWeightsCurve(numCtrlPoints);
+
+  // The array storage is contiguous, so the decoder can write into it directly
+  polesWeights.IsNull = !DecodeControlPtList(
+      controlPtListN, numCtrlPoints, &polesWeights.poles.ChangeFirst(),
+      &polesWeights.weights.ChangeFirst());
 
   return polesWeights;
 }
@@ -371,46 +778,12 @@ PolesWeightsSurface ParseControlPointsSurface(
     int const &vNumCtrlPoints) {
   auto polesWeights = PolesWeightsSurface(uNumCtrlPoints, vNumCtrlPoints);
 
-  LDOM_Node childN = controlPtListN.getFirstChild();
-  if (childN.isNull()) {
-    OCX_ERROR("No child node found in given ControlPointList element")
-    polesWeights.IsNull = true;
-    return polesWeights;
-  }
-
-  for (int u = 1; u <= uNumCtrlPoints; u++) {
-    for (int v = 1; v <= vNumCtrlPoints; v++) {
-      // Check for valid node type
-      const LDOM_Node::NodeType nodeType = childN.getNodeType();
-      if (nodeType != LDOM_Node::ELEMENT_NODE) {
-        OCX_ERROR(
-            "Invalid node type found in ControlPointList element. Got {}, but"
-            "expected {}",
-            nodeType, LDOM_Node::ELEMENT_NODE)
-        polesWeights.IsNull = true;
-        return polesWeights;
-      }
-
-      // Parse the control point
-      LDOM_Element controlPointN = (LDOM_Element &)childN;
-      LDOM_Element pointN = GetFirstChild(controlPointN, "Point3D");
-      if (pointN.isNull()) {
-        OCX_ERROR("No Point3D child node found in given ControlPoint element")
-        polesWeights.IsNull = true;
-        return polesWeights;
-      }
-
-      // Read the point
-      polesWeights.poles.SetValue(u, v, ReadPoint(pointN));
-
-      // Read the weight
-      double weight = 1.0;  // default weight
-      GetDoubleAttribute(pointN, "weight", weight);
-      polesWeights.weights.SetValue(u, v, weight);
-
-      childN = controlPointN.getNextSibling();
-    }
-  }
+  // The array storage is contiguous and row major, i.e. v varies fastest,
+  // which is the order of the control points in the ControlPtList
+  polesWeights.IsNull = !DecodeControlPtList(
+      controlPtListN, uNumCtrlPoints * vNumCtrlPoints,
+      &polesWeights.poles.ChangeValue(1, 1),
+      &polesWeights.weights.ChangeValue(1, 1));
 
   return polesWeights;
 }
@@ -525,9 +898,133 @@ TopoDS_Shape LimitShapeByWire(TopoDS_Shape const &shape,
 
 //-----------------------------------------------------------------------------
 
+namespace {
+
+/**
+ * Get the plane of a surface. B-spline and Bezier surfaces are treated as
+ * planes if they are planar within the given tolerance, which is the case
+ * for many surfaces given as NURBSSurface.
+ */
+std::optional<gp_Pln> AsPlane(const GeomAdaptor_Surface &S,
+                              double tolerance) {
+  switch (S.GetType()) {
+    case GeomAbs_Plane:
+      return S.Plane();
+    case GeomAbs_BSplineSurface:
+    case GeomAbs_BezierSurface: {
+      GeomLib_IsPlanarSurface planarSurface(S.Surface(), tolerance);
+      if (planarSurface.IsPlanar()) {
+        return planarSurface.Plan();
+      }
+      return std::nullopt;
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Make an edge from the single solution of an analytic intersection
+ * @returns nullopt if there is none or more than one solution, as the general
+ * intersection does
+ */
+std::optional<TopoDS_Edge> SingleSolution(const IntAna_QuadQuadGeo &inter) {
+  if (!inter.IsDone() || inter.NbSolutions() != 1) {
+    return std::nullopt;
+  }
+  switch (inter.TypeInter()) {
+    case IntAna_Line:
+      return BRepBuilderAPI_MakeEdge(inter.Line(1)).Edge();
+    case IntAna_Circle:
+      return BRepBuilderAPI_MakeEdge(inter.Circle(1)).Edge();
+    case IntAna_Ellipse:
+      return BRepBuilderAPI_MakeEdge(inter.Ellipse(1)).Edge();
+    default:
+      return std::nullopt;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Get the box the intersection of two surfaces is limited to by the B-spline
+ * and Bezier surfaces among them, which end at their parameter domain
+ * @returns nullopt if neither surface is bounded, a void box if the bounded
+ * surfaces do not overlap, the common box of the bounded surfaces else
+ */
+std::optional<Bnd_Box> IntersectionBox(const GeomAdaptor_Surface &S1,
+                                       const GeomAdaptor_Surface &S2) {
+  std::optional<Bnd_Box> result;
+  for (GeomAdaptor_Surface const *S : {&S1, &S2}) {
+    if (S->GetType() != GeomAbs_BSplineSurface &&
+        S->GetType() != GeomAbs_BezierSurface) {
+      continue;
+    }
+    Bnd_Box box;
+    BndLib_AddSurface::Add(*S, Precision::Confusion(), box);
+    if (!result.has_value()) {
+      result = box;
+      continue;
+    }
+    if (result->IsVoid() || box.IsVoid() || result->IsOut(box)) {
+      return Bnd_Box();
+    }
+
+    std::array<double, 3> min1{}, max1{}, min2{}, max2{};
+    result->Get(min1[0], min1[1], min1[2], max1[0], max1[1], max1[2]);
+    box.Get(min2[0], min2[1], min2[2], max2[0], max2[1], max2[2]);
+    Bnd_Box common;
+    common.Update(std::max(min1[0], min2[0]), std::max(min1[1], min2[1]),
+                  std::max(min1[2], min2[2]), std::min(max1[0], max2[0]),
+                  std::min(max1[1], max2[1]), std::min(max1[2], max2[2]));
+    result = common;
+  }
+  return result;
+}
+
+std::optional<TopoDS_Edge> LineLimitByBoundingBox(const gp_Lin &line,
+                                                  const Bnd_Box &box);
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 // TODO: Prototype, if solution is proven to work goes to -> OCCUtils::Surface
 std::optional<TopoDS_Edge> Intersection(const GeomAdaptor_Surface &S1,
                                         const GeomAdaptor_Surface &S2) {
+  // Most pairs are two planes or a plane and a cylinder, which are solved in
+  // closed form
+  std::optional<gp_Pln> P1 = AsPlane(S1, Precision::Confusion());
+  std::optional<gp_Pln> P2 = AsPlane(S2, Precision::Confusion());
+  if (P1.has_value() && P2.has_value()) {
+    IntAna_QuadQuadGeo const inter(*P1, *P2, Precision::Angular(),
+                                   Precision::Confusion());
+    // A planar B-spline or Bezier surface ends at its parameter domain, unlike
+    // the plane it lies in. Limit the line to the patch as the general
+    // intersection does.
+    if (std::optional<Bnd_Box> box = IntersectionBox(S1, S2);
+        box.has_value() && inter.IsDone() && inter.NbSolutions() == 1 &&
+        inter.TypeInter() == IntAna_Line) {
+      if (box->IsVoid()) {
+        return std::nullopt;
+      }
+      return LineLimitByBoundingBox(inter.Line(1), *box);
+    }
+    return SingleSolution(inter);
+  }
+  // Only true planes, the conics of a plane and a cylinder can not be limited
+  // to a patch by a box
+  if (S1.GetType() == GeomAbs_Plane && S2.GetType() == GeomAbs_Cylinder) {
+    return SingleSolution(IntAna_QuadQuadGeo(
+        *P1, S2.Cylinder(), Precision::Angular(), Precision::Confusion()));
+  }
+  if (S2.GetType() == GeomAbs_Plane && S1.GetType() == GeomAbs_Cylinder) {
+    return SingleSolution(IntAna_QuadQuadGeo(
+        *P2, S1.Cylinder(), Precision::Angular(), Precision::Confusion()));
+  }
+
   auto intersector =
       GeomAPI_IntSS(S1.Surface(), S2.Surface(), Precision::Confusion());
   if (!intersector
@@ -543,55 +1040,129 @@ std::optional<TopoDS_Edge> Intersection(const GeomAdaptor_Surface &S1,
 //-----------------------------------------------------------------------------
 
 // TODO: Prototype, if solution is proven to work goes to -> OCCUtils::Curve
-std::optional<TopoDS_Edge> CurveLimitByBoundingBox(
-    const GeomAdaptor_Curve &curve, const Bnd_Box &box) {
-  if (box.IsOut(curve.Line())) {
+namespace {
+
+/**
+ * Clip a line by an axis-aligned box with the slab test, intersecting the
+ * parameter ranges in which the line is between the two planes of each axis
+ */
+std::optional<TopoDS_Edge> LineLimitByBoundingBox(const gp_Lin &line,
+                                                  const Bnd_Box &box) {
+  std::array<double, 3> min{};
+  std::array<double, 3> max{};
+  box.Get(min[0], min[1], min[2], max[0], max[1], max[2]);
+
+  gp_XYZ const &origin = line.Location().XYZ();
+  gp_XYZ const &direction = line.Direction().XYZ();
+
+  double tMin = -Precision::Infinite();
+  double tMax = Precision::Infinite();
+  for (int i = 0; i < 3; i++) {
+    double const o = origin.Coord(i + 1);
+    double const d = direction.Coord(i + 1);
+    if (std::abs(d) < gp::Resolution()) {
+      // Parallel to the slab, either always or never in between
+      if (o < min[i] || o > max[i]) {
+        return std::nullopt;
+      }
+      continue;
+    }
+    double const t1 = (min[i] - o) / d;
+    double const t2 = (max[i] - o) / d;
+    tMin = std::max(tMin, std::min(t1, t2));
+    tMax = std::min(tMax, std::max(t1, t2));
+  }
+
+  if (tMax - tMin < Precision::Confusion()) {
     return std::nullopt;
   }
-  gp_Pnt max = box.CornerMin();
-  gp_Pnt min = box.CornerMax();
-
-  // Get bounding box planes as faces
-  std::vector<TopoDS_Face> faces{};
-  faces.emplace_back(OCCUtils::Face::FromPoints(
-      {gp_Pnt(min.X(), min.Y(), min.Z()), gp_Pnt(max.X(), min.Y(), min.Z()),
-       gp_Pnt(max.X(), max.Y(), min.Z())}));  // XYBottom
-  faces.emplace_back(OCCUtils::Face::FromPoints(
-      {gp_Pnt(min.X(), min.Y(), max.Z()), gp_Pnt(max.X(), min.Y(), max.Z()),
-       gp_Pnt(max.X(), max.Y(), max.Z())}));  // XYTop
-  faces.emplace_back(OCCUtils::Face::FromPoints(
-      {gp_Pnt(min.X(), min.Y(), min.Z()), gp_Pnt(min.X(), max.Y(), min.Z()),
-       gp_Pnt(min.X(), max.Y(), max.Z())}));  // XZLeft
-  faces.emplace_back(OCCUtils::Face::FromPoints(
-      {gp_Pnt(max.X(), min.Y(), min.Z()), gp_Pnt(max.X(), max.Y(), min.Z()),
-       gp_Pnt(max.X(), max.Y(), max.Z())}));  // XZRight
-  faces.emplace_back(OCCUtils::Face::FromPoints(
-      {gp_Pnt(min.X(), min.Y(), min.Z()), gp_Pnt(min.X(), min.Y(), max.Z()),
-       gp_Pnt(max.X(), min.Y(), max.Z())}));  // YZFront
-  faces.emplace_back(OCCUtils::Face::FromPoints(
-      {gp_Pnt(min.X(), max.Y(), min.Z()), gp_Pnt(min.X(), max.Y(), max.Z()),
-       gp_Pnt(max.X(), max.Y(), max.Z())}));  // YZBack
-
-  // Intersect faces with curve
-  std::vector<gp_Pnt> intersectionPoints{};
-  for (const auto &face : faces) {
-    GeomAdaptor_Surface surfaceAdapter =
-        OCCUtils::Surface::FromFace(TopoDS::Face(face));
-
-    if (std::optional pnt = OCCUtils::Surface::Intersection(
-            curve.Line(), surfaceAdapter.Surface())) {
-      intersectionPoints.push_back(pnt.value());
-    }
-  }
-
-  if (intersectionPoints.size() != 2) {
+  return BRepBuilderAPI_MakeEdge(line, tMin, tMax).Edge();
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Clip a bounded curve by an axis-aligned box. The curve is split at its
+ * intersections with the six planes of the box, the one piece inside of the
+ * box is kept.
+ */
+std::optional<TopoDS_Edge> BoundedCurveLimitByBoundingBox(
+    const GeomAdaptor_Curve &curve, const Bnd_Box &box) {
+  double const first = curve.FirstParameter();
+  double const last = curve.LastParameter();
+  if (Precision::IsInfinite(first) || Precision::IsInfinite(last)) {
     return std::nullopt;
   }
 
-  // Limit the curve to the bounding box
-  return BRepBuilderAPI_MakeEdge(curve.Line(), intersectionPoints[0],
-                                 intersectionPoints[1])
+  gp_Pnt const min = box.CornerMin();
+  gp_Pnt const max = box.CornerMax();
+  std::array<gp_Pln, 6> const planes{
+      gp_Pln(min, gp::DX()), gp_Pln(max, gp::DX()), gp_Pln(min, gp::DY()),
+      gp_Pln(max, gp::DY()), gp_Pln(min, gp::DZ()), gp_Pln(max, gp::DZ())};
+
+  std::vector<double> params{first, last};
+  for (gp_Pln const &plane : planes) {
+    GeomAPI_IntCS intersector(curve.Curve(), new Geom_Plane(plane));
+    if (!intersector.IsDone()) {
+      return std::nullopt;
+    }
+    for (int i = 1; i <= intersector.NbPoints(); i++) {
+      double u = 0;
+      double v = 0;
+      double w = 0;
+      intersector.Parameters(i, u, v, w);
+      if (w > first && w < last) {
+        params.push_back(w);
+      }
+    }
+  }
+  std::sort(params.begin(), params.end());
+
+  // Pieces of the curve inside of the box, adjacent ones are joined
+  std::vector<std::pair<double, double>> pieces;
+  for (std::size_t i = 0; i + 1 < params.size(); i++) {
+    if (params[i + 1] - params[i] < Precision::PConfusion()) {
+      continue;
+    }
+    if (box.IsOut(curve.Value((params[i] + params[i + 1]) / 2))) {
+      continue;
+    }
+    if (!pieces.empty() &&
+        params[i] - pieces.back().second < Precision::PConfusion()) {
+      pieces.back().second = params[i + 1];
+    } else {
+      pieces.emplace_back(params[i], params[i + 1]);
+    }
+  }
+
+  // A closed curve may have the piece inside of the box split at its seam
+  if (pieces.size() == 2 && curve.IsPeriodic() &&
+      pieces.front().first - first < Precision::PConfusion() &&
+      last - pieces.back().second < Precision::PConfusion()) {
+    pieces = {{pieces.back().first, pieces.front().second + curve.Period()}};
+  }
+
+  if (pieces.size() != 1) {
+    return std::nullopt;
+  }
+  return BRepBuilderAPI_MakeEdge(curve.Curve(), pieces.front().first,
+                                 pieces.front().second)
       .Edge();
 }
 
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+std::optional<TopoDS_Edge> CurveLimitByBoundingBox(
+    const GeomAdaptor_Curve &curve, const Bnd_Box &box) {
+  if (box.IsVoid()) {
+    return std::nullopt;
+  }
+  if (curve.GetType() == GeomAbs_Line) {
+    return LineLimitByBoundingBox(curve.Line(), box);
+  }
+  return BoundedCurveLimitByBoundingBox(curve, box);
+}
+
 }  // namespace ocx::helper
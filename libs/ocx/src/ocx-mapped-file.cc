@@ -0,0 +1,125 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-mapped-file.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "ocx/internal/ocx-log.h"
+
+namespace ocx::stream {
+
+std::shared_ptr<MappedFile> MappedFile::Open(std::string const &filename) {
+  auto file = create();
+
+#ifdef _WIN32
+  HANDLE hFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                             nullptr, OPEN_EXISTING,
+                             FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (hFile == INVALID_HANDLE_VALUE) {
+    OCX_ERROR("Could not open file {} for mapping", filename)
+    return nullptr;
+  }
+  file->m_file = hFile;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(hFile, &size)) {
+    OCX_ERROR("Could not get size of file {}", filename)
+    return nullptr;
+  }
+  file->m_size = static_cast<std::size_t>(size.QuadPart);
+  if (file->m_size == 0) {
+    return file;
+  }
+
+  HANDLE hMapping =
+      CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (hMapping == nullptr) {
+    OCX_ERROR("Could not create file mapping for file {}", filename)
+    return nullptr;
+  }
+  file->m_mapping = hMapping;
+
+  void *data = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == nullptr) {
+    OCX_ERROR("Could not map file {} into memory", filename)
+    return nullptr;
+  }
+  file->m_data = static_cast<char const *>(data);
+#else
+  file->m_fd = open(filename.c_str(), O_RDONLY);
+  if (file->m_fd < 0) {
+    OCX_ERROR("Could not open file {} for mapping", filename)
+    return nullptr;
+  }
+
+  struct stat st {};
+  if (fstat(file->m_fd, &st) != 0) {
+    OCX_ERROR("Could not get size of file {}", filename)
+    return nullptr;
+  }
+  file->m_size = static_cast<std::size_t>(st.st_size);
+  if (file->m_size == 0) {
+    return file;
+  }
+
+  void *data =
+      mmap(nullptr, file->m_size, PROT_READ, MAP_PRIVATE, file->m_fd, 0);
+  if (data == MAP_FAILED) {
+    OCX_ERROR("Could not map file {} into memory", filename)
+    return nullptr;
+  }
+  file->m_data = static_cast<char const *>(data);
+
+  // The document is scanned front to back
+  madvise(data, file->m_size, MADV_SEQUENTIAL);
+#endif
+
+  return file;
+}
+
+//-----------------------------------------------------------------------------
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+  if (m_data != nullptr) UnmapViewOfFile(m_data);
+  if (m_mapping != nullptr) CloseHandle(m_mapping);
+  if (m_file != nullptr) CloseHandle(m_file);
+#else
+  if (m_data != nullptr) {
+    munmap(const_cast<char *>(m_data), m_size);
+  }
+  if (m_fd >= 0) close(m_fd);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+std::string_view MappedFile::Data() const { return {m_data, m_size}; }
+
+}  // namespace ocx::stream
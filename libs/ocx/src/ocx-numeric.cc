@@ -0,0 +1,78 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-numeric.h"
+
+#include <charconv>
+#include <string_view>
+#include <system_error>
+
+namespace ocx::utils {
+
+namespace {
+
+bool IsSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+LengthUnit ParseLengthUnit(std::string_view symbol) {
+  if (symbol == "m") return LengthUnit::M;
+  if (symbol == "dm") return LengthUnit::Dm;
+  if (symbol == "cm") return LengthUnit::Cm;
+  if (symbol == "mm") return LengthUnit::Mm;
+  return LengthUnit::Unknown;
+}
+
+//-----------------------------------------------------------------------------
+
+double LengthUnitFactor(LengthUnit unit) {
+  switch (unit) {
+    case LengthUnit::Dm:
+      return 1 / 10.0;
+    case LengthUnit::Cm:
+      return 1 / 100.0;
+    case LengthUnit::Mm:
+      return 1 / 1000.0;
+    case LengthUnit::M:
+    case LengthUnit::Unknown:
+      break;
+  }
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ParseDouble(std::string_view text, double &value) {
+  while (!text.empty() && IsSpace(text.front())) text.remove_prefix(1);
+  while (!text.empty() && IsSpace(text.back())) text.remove_suffix(1);
+  // std::from_chars does not accept an explicit plus sign
+  if (text.size() > 1 && text.front() == '+' && text[1] != '-') {
+    text.remove_prefix(1);
+  }
+
+  double result;
+  auto [ptr, ec] =
+      std::from_chars(text.data(), text.data() + text.size(), result);
+  if (ec != std::errc() || ptr != text.data() + text.size()) {
+    return false;
+  }
+  value = result;
+  return true;
+}
+
+}  // namespace ocx::utils
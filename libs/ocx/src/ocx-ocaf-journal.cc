@@ -0,0 +1,68 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "ocx/internal/ocx-ocaf-journal.h"
+
+#include <TDataStd_Name.hxx>
+#include <utility>
+
+namespace ocx {
+
+thread_local OCAFJournal *OCAFJournal::s_current = nullptr;
+
+//-----------------------------------------------------------------------------
+
+OCAFJournal::Scope::Scope(OCAFJournal &journal)
+    : m_previous(std::exchange(s_current, &journal)) {}
+
+//-----------------------------------------------------------------------------
+
+OCAFJournal::Scope::~Scope() { s_current = m_previous; }
+
+//-----------------------------------------------------------------------------
+
+OCAFJournal *OCAFJournal::Current() { return s_current; }
+
+//-----------------------------------------------------------------------------
+
+void OCAFJournal::Record(TopoDS_Shape const &shape, bool makeAssembly,
+                         std::string name,
+                         std::optional<Quantity_Color> const &color,
+                         XCAFDoc_ColorType colorType) {
+  m_entries.push_back({shape, makeAssembly, std::move(name), color, colorType});
+}
+
+//-----------------------------------------------------------------------------
+
+void OCAFJournal::Append(OCAFJournal const &journal) {
+  m_entries.insert(m_entries.end(), journal.m_entries.begin(),
+                   journal.m_entries.end());
+}
+
+//-----------------------------------------------------------------------------
+
+void OCAFJournal::Replay(
+    opencascade::handle<XCAFDoc_ShapeTool> const &shapeTool,
+    opencascade::handle<XCAFDoc_ColorTool> const &colorTool) const {
+  for (Entry const &entry : m_entries) {
+    TDF_Label label = shapeTool->AddShape(entry.shape, entry.makeAssembly);
+    TDataStd_Name::Set(label, entry.name.c_str());
+    if (entry.color.has_value()) {
+      colorTool->SetColor(label, *entry.color, entry.colorType);
+    }
+  }
+}
+
+}  // namespace ocx
@@ -0,0 +1,211 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-panel-index.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "ocx/internal/ocx-log.h"
+
+namespace ocx::stream {
+
+namespace {
+
+constexpr char const *kIndexMagic = "OCXIDX";
+constexpr int kIndexVersion = 2;
+
+// Placeholder for empty attributes, the fields are whitespace separated
+constexpr char const *kEmptyField = "-";
+
+/**
+ * Get the file size and modification time the index is keyed by
+ */
+bool GetFileKey(std::string const &filename, std::uintmax_t &size,
+                std::int64_t &mtime) {
+  std::error_code ec;
+  size = std::filesystem::file_size(filename, ec);
+  if (ec) return false;
+  auto const writeTime = std::filesystem::last_write_time(filename, ec);
+  if (ec) return false;
+  mtime = static_cast<std::int64_t>(writeTime.time_since_epoch().count());
+  return true;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+std::string PanelIndexPath(std::string const &filename) {
+  return filename + ".ocxidx";
+}
+
+//-----------------------------------------------------------------------------
+
+bool WritePanelIndex(std::string const &filename,
+                     std::vector<PanelRange> const &panels) {
+  std::uintmax_t size = 0;
+  std::int64_t mtime = 0;
+  if (!GetFileKey(filename, size, mtime)) {
+    OCX_ERROR("Failed to get size and modification time of file {}", filename)
+    return false;
+  }
+
+  std::string const indexPath = PanelIndexPath(filename);
+  std::ofstream os(indexPath, std::ios::out | std::ios::trunc);
+  if (!os) {
+    OCX_ERROR("Could not open index file {} for writing", indexPath)
+    return false;
+  }
+
+  os << kIndexMagic << ' ' << kIndexVersion << '\n'
+     << size << ' ' << mtime << '\n'
+     << panels.size() << '\n';
+  for (PanelRange const &panel : panels) {
+    os << panel.begin << ' ' << panel.end << ' '
+       << (panel.guid.empty() ? kEmptyField : panel.guid) << ' '
+       << (panel.id.empty() ? kEmptyField : panel.id) << ' '
+       << panel.plateGuids.size();
+    for (std::string const &plateGuid : panel.plateGuids) {
+      os << ' ' << plateGuid;
+    }
+    os << '\n';
+  }
+
+  if (!os) {
+    OCX_ERROR("Failed to write index file {}", indexPath)
+    return false;
+  }
+  OCX_INFO("Wrote index of {} Panel elements to {}", panels.size(), indexPath)
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ReadPanelIndex(std::string const &filename,
+                    std::vector<PanelRange> &panels) {
+  std::string const indexPath = PanelIndexPath(filename);
+  std::ifstream is(indexPath);
+  if (!is) {
+    OCX_INFO("No index file {} found", indexPath)
+    return false;
+  }
+
+  std::string magic;
+  int version = 0;
+  std::uintmax_t size = 0;
+  std::int64_t mtime = 0;
+  std::size_t numPanels = 0;
+  is >> magic >> version >> size >> mtime >> numPanels;
+  if (!is || magic != kIndexMagic || version != kIndexVersion) {
+    OCX_WARN("Ignoring invalid index file {}", indexPath)
+    return false;
+  }
+
+  std::uintmax_t fileSize = 0;
+  std::int64_t fileMtime = 0;
+  if (!GetFileKey(filename, fileSize, fileMtime) || fileSize != size ||
+      fileMtime != mtime) {
+    OCX_INFO("Ignoring outdated index file {}", indexPath)
+    return false;
+  }
+
+  std::vector<PanelRange> result(numPanels);
+  for (PanelRange &panel : result) {
+    std::size_t numPlates = 0;
+    is >> panel.begin >> panel.end >> panel.guid >> panel.id >> numPlates;
+    if (!is) break;
+    if (panel.guid == kEmptyField) panel.guid.clear();
+    if (panel.id == kEmptyField) panel.id.clear();
+    for (std::size_t i = 0; i < numPlates && is; i++) {
+      is >> panel.plateGuids.emplace_back();
+    }
+  }
+  if (!is) {
+    OCX_WARN("Ignoring truncated index file {}", indexPath)
+    return false;
+  }
+
+  panels = std::move(result);
+  OCX_INFO("Read index of {} Panel elements from {}", panels.size(),
+           indexPath)
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BuildSkeleton(std::istream &is, std::vector<PanelRange> const &panels,
+                   std::string &skeleton) {
+  skeleton.clear();
+
+  std::streamoff offset = 0;
+  for (PanelRange const &panel : panels) {
+    if (panel.begin < offset) {
+      OCX_ERROR("Invalid Panel range at byte offset {}", panel.begin)
+      return false;
+    }
+    auto const size = static_cast<std::size_t>(panel.begin - offset);
+    std::size_t const skeletonSize = skeleton.size();
+    skeleton.resize(skeletonSize + size);
+    is.clear();
+    is.seekg(offset);
+    is.read(skeleton.data() + skeletonSize, static_cast<std::streamsize>(size));
+    if (is.gcount() != static_cast<std::streamsize>(size)) {
+      OCX_ERROR("Failed to read document skeleton at byte offset {}", offset)
+      return false;
+    }
+    offset = panel.end;
+  }
+
+  // Remainder after the last Panel
+  is.clear();
+  is.seekg(offset);
+  std::vector<char> chunk(1 << 16);
+  while (is) {
+    is.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    skeleton.append(chunk.data(), static_cast<std::size_t>(is.gcount()));
+  }
+  return !is.bad();
+}
+
+//-----------------------------------------------------------------------------
+
+bool BuildSkeleton(std::string_view data, std::vector<PanelRange> const &panels,
+                   std::string &skeleton) {
+  skeleton.clear();
+
+  std::size_t offset = 0;
+  for (PanelRange const &panel : panels) {
+    auto const begin = static_cast<std::size_t>(panel.begin);
+    if (begin < offset || begin > data.size()) {
+      OCX_ERROR("Invalid Panel range at byte offset {}", panel.begin)
+      return false;
+    }
+    skeleton.append(data.substr(offset, begin - offset));
+    offset = static_cast<std::size_t>(panel.end);
+  }
+  if (offset > data.size()) {
+    OCX_ERROR("Invalid Panel range at byte offset {}", offset)
+    return false;
+  }
+  skeleton.append(data.substr(offset));
+  return true;
+}
+
+}  // namespace ocx::stream
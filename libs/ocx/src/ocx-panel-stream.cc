@@ -0,0 +1,596 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-panel-stream.h"
+
+#include <LDOMParser.hxx>
+#include <LDOM_Document.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ocx/internal/ocx-log.h"
+#include "ocx/internal/ocx-parallel.h"
+
+namespace ocx::stream {
+
+namespace {
+
+std::string_view LocalName(std::string_view tagName) {
+  if (std::size_t idx = tagName.find(':'); idx != std::string_view::npos) {
+    return tagName.substr(idx + 1);
+  }
+  return tagName;
+}
+
+bool IsSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Get the value of an attribute from the raw text of a start tag, the
+ * attribute is matched by its local name
+ */
+std::string GetTagAttribute(std::string_view tag, std::string_view localName) {
+  std::size_t pos = tag.find_first_of(" \t\n\r");
+  while (pos != std::string_view::npos && pos < tag.size()) {
+    std::size_t const nameBegin = tag.find_first_not_of(" \t\n\r", pos);
+    if (nameBegin == std::string_view::npos) break;
+    std::size_t const eq = tag.find('=', nameBegin);
+    if (eq == std::string_view::npos) break;
+    std::size_t const quoteBegin = tag.find_first_of("\"'", eq);
+    if (quoteBegin == std::string_view::npos) break;
+    std::size_t const quoteEnd = tag.find(tag[quoteBegin], quoteBegin + 1);
+    if (quoteEnd == std::string_view::npos) break;
+
+    std::string_view name = tag.substr(nameBegin, eq - nameBegin);
+    while (!name.empty() && IsSpace(name.back())) name.remove_suffix(1);
+    if (LocalName(name) == localName) {
+      return std::string(
+          tag.substr(quoteBegin + 1, quoteEnd - quoteBegin - 1));
+    }
+    pos = quoteEnd + 1;
+  }
+  return {};
+}
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Incremental scanner behind SplitPanels, the input may be fed in chunks
+ */
+class PanelScanner {
+ public:
+  PanelScanner(std::string &skeleton, std::vector<PanelRange> &panels,
+               std::streamoff offset)
+      : m_skeleton(skeleton), m_panels(panels), m_offset(offset) {}
+
+  bool Feed(char const *data, std::size_t size);
+
+  bool Finish() const;
+
+  [[nodiscard]] std::streamoff Offset() const { return m_offset; }
+
+ private:
+  enum class State {
+    Text,
+    Markup,     // after '<', kind of markup not yet known
+    Bang,       // after '<!', comment, CDATA or declaration
+    StartTag,   // reading the name of a start tag
+    InTag,      // reading attributes of a start tag
+    AttrValue,  // inside a quoted attribute value
+    EndTag,     // inside an end tag
+    Comment,
+    CData,
+    PI,
+    Declaration
+  };
+
+  void OpenElement(bool selfClosing);
+  bool CloseElement();
+
+  std::string &m_skeleton;
+  std::vector<PanelRange> &m_panels;
+  std::streamoff m_offset;
+
+  State m_state = State::Text;
+  std::string m_tagName;
+  std::string m_bang;
+  char m_quote = 0;
+  char m_prev = 0;
+  char m_prevPrev = 0;
+  int m_bracketDepth = 0;
+
+  // Names of the currently open elements up to the Vessel level
+  std::vector<std::string> m_openNames;
+  int m_depth = 0;
+
+  bool m_inPanel = false;
+  int m_panelDepth = 0;
+  std::streamoff m_panelBegin = 0;
+  std::string m_panelGuid;
+  std::string m_panelId;
+  std::vector<std::string> m_plateGuids;
+  // Name of the open child element of the Panel
+  std::string m_panelChildName;
+
+  std::streamoff m_tagBegin = 0;
+  std::size_t m_skeletonMark = 0;
+
+  // Raw text of the current start tag, used to read the Panel attributes
+  std::string m_tagText;
+};
+
+//-----------------------------------------------------------------------------
+
+void PanelScanner::OpenElement(bool selfClosing) {
+  m_depth++;
+  if (!m_inPanel && m_depth == 3 && m_openNames.size() == 2 &&
+      LocalName(m_openNames[1]) == "Vessel" &&
+      LocalName(m_tagName) == "Panel") {
+    m_inPanel = true;
+    m_panelDepth = m_depth;
+    m_panelBegin = m_tagBegin;
+    m_panelGuid = GetTagAttribute(m_tagText, "GUIDRef");
+    m_panelId = GetTagAttribute(m_tagText, "id");
+    m_plateGuids.clear();
+    // Drop the already copied part of the Panel start tag
+    m_skeleton.resize(m_skeletonMark);
+  } else if (m_inPanel && m_depth == m_panelDepth + 1) {
+    m_panelChildName = m_tagName;
+  } else if (m_inPanel && m_depth == m_panelDepth + 2 &&
+             LocalName(m_panelChildName) == "ComposedOf" &&
+             LocalName(m_tagName) == "Plate") {
+    if (std::string guid = GetTagAttribute(m_tagText, "GUIDRef");
+        !guid.empty()) {
+      m_plateGuids.push_back(std::move(guid));
+    }
+  }
+  if (m_depth <= 2) {
+    m_openNames.push_back(m_tagName);
+  }
+  if (selfClosing) {
+    if (m_inPanel && m_depth == m_panelDepth) {
+      m_panels.push_back({m_panelBegin, m_offset + 1, m_panelGuid, m_panelId,
+                          std::move(m_plateGuids)});
+      m_inPanel = false;
+    }
+    if (m_depth <= 2) m_openNames.pop_back();
+    m_depth--;
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+bool PanelScanner::CloseElement() {
+  if (m_depth == 0) {
+    OCX_ERROR("Unbalanced end tag found at byte offset {}", m_offset)
+    return false;
+  }
+  if (m_inPanel && m_depth == m_panelDepth) {
+    m_panels.push_back({m_panelBegin, m_offset + 1, m_panelGuid, m_panelId,
+                        std::move(m_plateGuids)});
+    m_inPanel = false;
+  }
+  if (m_depth <= 2) m_openNames.pop_back();
+  m_depth--;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool PanelScanner::Feed(char const *data, std::size_t size) {
+  for (std::size_t i = 0; i < size; i++, m_offset++) {
+    char const c = data[i];
+    bool const wasInPanel = m_inPanel;
+    std::size_t const numPanels = m_panels.size();
+
+    switch (m_state) {
+      case State::Text:
+        if (c == '<') {
+          m_state = State::Markup;
+          m_tagBegin = m_offset;
+          m_skeletonMark = m_skeleton.size();
+        }
+        break;
+      case State::Markup:
+        if (c == '/') {
+          m_state = State::EndTag;
+        } else if (c == '?') {
+          m_state = State::PI;
+        } else if (c == '!') {
+          m_state = State::Bang;
+          m_bang.clear();
+        } else {
+          m_state = State::StartTag;
+          m_tagName.assign(1, c);
+          m_tagText.assign(1, c);
+        }
+        break;
+      case State::Bang:
+        m_bang.push_back(c);
+        if (m_bang == "--") {
+          m_state = State::Comment;
+          // Reset to not treat '<!-->' as closed comment
+          m_prev = m_prevPrev = 0;
+        } else if (m_bang == "[CDATA[") {
+          m_state = State::CData;
+          m_prev = m_prevPrev = 0;
+        } else if (std::string_view("--").substr(0, m_bang.size()) != m_bang &&
+                   std::string_view("[CDATA[").substr(0, m_bang.size()) !=
+                       m_bang) {
+          m_state = State::Declaration;
+          m_bracketDepth = 0;
+          if (c == '[') m_bracketDepth++;
+          if (c == '>') m_state = State::Text;
+        }
+        break;
+      case State::StartTag:
+        m_tagText.push_back(c);
+        if (IsSpace(c)) {
+          m_state = State::InTag;
+        } else if (c == '>') {
+          m_state = State::Text;
+          OpenElement(m_prev == '/');
+        } else if (c != '/') {
+          m_tagName.push_back(c);
+        }
+        break;
+      case State::InTag:
+        m_tagText.push_back(c);
+        if (c == '"' || c == '\'') {
+          m_state = State::AttrValue;
+          m_quote = c;
+        } else if (c == '>') {
+          m_state = State::Text;
+          OpenElement(m_prev == '/');
+        }
+        break;
+      case State::AttrValue:
+        m_tagText.push_back(c);
+        if (c == m_quote) {
+          m_state = State::InTag;
+        }
+        break;
+      case State::EndTag:
+        if (c == '>') {
+          m_state = State::Text;
+          if (!CloseElement()) return false;
+        }
+        break;
+      case State::Comment:
+        if (c == '>' && m_prev == '-' && m_prevPrev == '-') {
+          m_state = State::Text;
+        }
+        break;
+      case State::CData:
+        if (c == '>' && m_prev == ']' && m_prevPrev == ']') {
+          m_state = State::Text;
+        }
+        break;
+      case State::PI:
+        if (c == '>' && m_prev == '?') {
+          m_state = State::Text;
+        }
+        break;
+      case State::Declaration:
+        if (c == '[') {
+          m_bracketDepth++;
+        } else if (c == ']') {
+          m_bracketDepth--;
+        } else if (c == '>' && m_bracketDepth <= 0) {
+          m_state = State::Text;
+        }
+        break;
+    }
+
+    // Copy everything outside the Panel subtrees to the skeleton. The last
+    // character of a Panel is skipped as well.
+    if (!m_inPanel && !(wasInPanel || m_panels.size() != numPanels)) {
+      m_skeleton.push_back(c);
+    }
+
+    m_prevPrev = m_prev;
+    m_prev = c;
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool PanelScanner::Finish() const {
+  if (m_inPanel || m_depth != 0 || m_state != State::Text) {
+    OCX_ERROR("Unexpected end of document at byte offset {}", m_offset)
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+MemoryBuffer::MemoryBuffer(char const *begin, char const *end) {
+  // std::streambuf only offers a non-const interface, but get area is never
+  // written to
+  setg(const_cast<char *>(begin), const_cast<char *>(begin),
+       const_cast<char *>(end));
+}
+
+MemoryBuffer::pos_type MemoryBuffer::seekoff(off_type off,
+                                             std::ios_base::seekdir dir,
+                                             std::ios_base::openmode which) {
+  if ((which & std::ios_base::in) == 0) {
+    return pos_type(off_type(-1));
+  }
+
+  off_type base = 0;
+  if (dir == std::ios_base::cur) {
+    base = gptr() - eback();
+  } else if (dir == std::ios_base::end) {
+    base = egptr() - eback();
+  }
+  off_type const target = base + off;
+  if (target < 0 || target > egptr() - eback()) {
+    return pos_type(off_type(-1));
+  }
+
+  setg(eback(), eback() + target, egptr());
+  return pos_type(target);
+}
+
+MemoryBuffer::pos_type MemoryBuffer::seekpos(pos_type pos,
+                                             std::ios_base::openmode which) {
+  return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+//-----------------------------------------------------------------------------
+
+bool SplitPanels(std::istream &is, std::string &skeleton,
+                 std::vector<PanelRange> &panels) {
+  std::streamoff offset = is.tellg();
+  PanelScanner scanner(skeleton, panels, offset < 0 ? 0 : offset);
+
+  std::vector<char> chunk(1 << 16);
+  while (is) {
+    is.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    std::streamsize const numRead = is.gcount();
+    if (numRead <= 0) break;
+    if (!scanner.Feed(chunk.data(), static_cast<std::size_t>(numRead))) {
+      return false;
+    }
+  }
+
+  if (is.bad()) {
+    OCX_ERROR("Failed to read from input stream at byte offset {}",
+              scanner.Offset())
+    return false;
+  }
+  return scanner.Finish();
+}
+
+//-----------------------------------------------------------------------------
+
+bool SplitPanels(std::string_view data, std::string &skeleton,
+                 std::vector<PanelRange> &panels) {
+  PanelScanner scanner(skeleton, panels, 0);
+  return scanner.Feed(data.data(), data.size()) && scanner.Finish();
+}
+
+//-----------------------------------------------------------------------------
+
+PanelStream::PanelStream(std::shared_ptr<std::istream> is,
+                         std::vector<PanelRange> ranges)
+    : m_stream(std::move(is)), m_ranges(std::move(ranges)) {
+  IndexRanges();
+}
+
+PanelStream::PanelStream(std::shared_ptr<MappedFile> file,
+                         std::vector<PanelRange> ranges)
+    : m_file(std::move(file)), m_ranges(std::move(ranges)) {
+  IndexRanges();
+}
+
+//-----------------------------------------------------------------------------
+
+void PanelStream::IndexRanges() {
+  for (std::size_t idx = 0; idx < m_ranges.size(); idx++) {
+    if (!m_ranges[idx].guid.empty()) {
+      m_guid2index.try_emplace(m_ranges[idx].guid, idx);
+    }
+    if (!m_ranges[idx].id.empty()) {
+      m_guid2index.try_emplace(m_ranges[idx].id, idx);
+    }
+    for (std::string const &plateGuid : m_ranges[idx].plateGuids) {
+      m_plate2index.try_emplace(plateGuid, idx);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+std::optional<std::size_t> PanelStream::FindPanel(
+    std::string_view guidOrId) const {
+  if (auto res = m_guid2index.find(guidOrId); res != m_guid2index.end()) {
+    return res->second;
+  }
+  return std::nullopt;
+}
+
+//-----------------------------------------------------------------------------
+
+std::optional<std::size_t> PanelStream::FindOwner(std::string_view guid) const {
+  if (auto res = m_plate2index.find(guid); res != m_plate2index.end()) {
+    return res->second;
+  }
+  return FindPanel(guid);
+}
+
+//-----------------------------------------------------------------------------
+
+std::vector<PanelRange> const &PanelStream::Ranges() const { return m_ranges; }
+
+//-----------------------------------------------------------------------------
+
+std::size_t PanelStream::Size() const { return m_ranges.size(); }
+
+//-----------------------------------------------------------------------------
+
+void PanelStream::SetNumThreads(unsigned int numThreads) {
+  m_numThreads = std::max(1U, numThreads);
+}
+
+unsigned int PanelStream::NumThreads() const { return m_numThreads; }
+
+//-----------------------------------------------------------------------------
+
+LDOM_Element PanelStream::ReadPanel(std::size_t idx) {
+  if (idx >= m_ranges.size()) {
+    OCX_ERROR("Panel index {} out of range, only {} panels available", idx,
+              m_ranges.size())
+    return {};
+  }
+  if (!m_preloaded.empty()) {
+    return m_preloaded[idx];
+  }
+
+  std::string_view panelData = GetPanelData(idx, m_buffer);
+  if (panelData.empty()) {
+    return {};
+  }
+  return ParsePanel(idx, panelData);
+}
+
+//-----------------------------------------------------------------------------
+
+std::vector<LDOM_Element> PanelStream::ReadPanels(std::size_t first,
+                                                  std::size_t count) {
+  std::size_t const last = std::min(first + count, m_ranges.size());
+  if (first >= last) {
+    return {};
+  }
+  if (!m_preloaded.empty()) {
+    return {m_preloaded.begin() + static_cast<std::ptrdiff_t>(first),
+            m_preloaded.begin() + static_cast<std::ptrdiff_t>(last)};
+  }
+
+  std::vector<std::size_t> indices(last - first);
+  for (std::size_t idx = first; idx < last; idx++) {
+    indices[idx - first] = idx;
+  }
+  return ReadPanels(indices);
+}
+
+//-----------------------------------------------------------------------------
+
+std::vector<LDOM_Element> PanelStream::ReadPanels(
+    std::vector<std::size_t> const &indices) {
+  std::vector<LDOM_Element> panels(indices.size());
+  if (!m_preloaded.empty() || m_numThreads <= 1) {
+    for (std::size_t i = 0; i < indices.size(); i++) {
+      panels[i] = ReadPanel(indices[i]);
+    }
+    return panels;
+  }
+
+  // Read the raw data up front, the input stream can not be shared between
+  // the worker threads
+  std::vector<std::string> buffers(indices.size());
+  std::vector<std::string_view> panelData(indices.size());
+  for (std::size_t i = 0; i < indices.size(); i++) {
+    if (indices[i] >= m_ranges.size()) {
+      OCX_ERROR("Panel index {} out of range, only {} panels available",
+                indices[i], m_ranges.size())
+      continue;
+    }
+    panelData[i] = GetPanelData(indices[i], buffers[i]);
+  }
+
+  // Each Panel is parsed into its own LDOM document, so the workers share no
+  // state besides the next index to process
+  ocx::utils::ParallelFor(panelData.size(), m_numThreads, [&](std::size_t i) {
+    if (!panelData[i].empty()) {
+      panels[i] = ParsePanel(indices[i], panelData[i]);
+    }
+  });
+
+  return panels;
+}
+
+//-----------------------------------------------------------------------------
+
+void PanelStream::Preload() {
+  // Limit the raw data held at once when reading from a stream
+  std::size_t const batchSize = 64 * static_cast<std::size_t>(m_numThreads);
+
+  std::vector<LDOM_Element> preloaded;
+  preloaded.reserve(m_ranges.size());
+  for (std::size_t first = 0; first < m_ranges.size(); first += batchSize) {
+    std::vector<LDOM_Element> batch = ReadPanels(first, batchSize);
+    preloaded.insert(preloaded.end(), batch.begin(), batch.end());
+  }
+  m_preloaded = std::move(preloaded);
+}
+
+//-----------------------------------------------------------------------------
+
+std::string_view PanelStream::GetPanelData(std::size_t idx,
+                                           std::string &buffer) {
+  PanelRange const &range = m_ranges[idx];
+  auto const size = static_cast<std::size_t>(range.end - range.begin);
+
+  if (m_file != nullptr) {
+    // Parse straight from the mapped pages
+    return m_file->Data().substr(static_cast<std::size_t>(range.begin), size);
+  }
+
+  // The buffer capacity grows to the size of the largest Panel
+  buffer.resize(size);
+  m_stream->clear();
+  m_stream->seekg(range.begin);
+  m_stream->read(buffer.data(), static_cast<std::streamsize>(size));
+  if (m_stream->gcount() != static_cast<std::streamsize>(size)) {
+    OCX_ERROR("Failed to read Panel #{} at byte offset {}", idx, range.begin)
+    return {};
+  }
+  return buffer;
+}
+
+//-----------------------------------------------------------------------------
+
+LDOM_Element PanelStream::ParsePanel(std::size_t idx,
+                                     std::string_view panelData) const {
+  MemoryBuffer memoryBuffer(panelData.data(),
+                            panelData.data() + panelData.size());
+  std::istream panelStream(&memoryBuffer);
+
+  LDOMParser aParser;
+  if (aParser.parse(panelStream, Standard_False, Standard_False)) {
+    TCollection_AsciiString aData;
+    aParser.GetError(aData);
+    OCX_ERROR("Failed to parse Panel #{} at byte offset {}\n{}", idx,
+              m_ranges[idx].begin, aData.ToCString())
+    return {};
+  }
+
+  // The element keeps its LDOM document alive until it goes out of scope
+  return aParser.getDocument().getDocumentElement();
+}
+
+}  // namespace ocx::stream
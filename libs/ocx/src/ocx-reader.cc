@@ -20,17 +20,76 @@
 #include <OSD_FileSystem.hxx>
 #include <STEPCAFControl_Reader.hxx>
 #include <TDataStd_Name.hxx>
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "ocx/internal/ocx-coordinate-system.h"
+#include "ocx/internal/ocx-decompress.h"
 #include "ocx/internal/ocx-log.h"
+#include "ocx/internal/ocx-mapped-file.h"
+#include "ocx/internal/ocx-panel-index.h"
+#include "ocx/internal/ocx-panel-stream.h"
+#include "ocx/internal/ocx-parallel.h"
 #include "ocx/internal/ocx-utils.h"
 #include "ocx/internal/ocx-vessel.h"
 #include "ocx/ocx-helper.h"
 
 namespace ocx {
 
+namespace {
+
+/**
+ * Split the document into the skeleton and the Panel ranges. The ranges are
+ * taken from the sidecar index if enabled and up to date, otherwise the
+ * document is scanned (and the index written if enabled).
+ */
+bool SplitDocument(std::string const &filename,
+                   std::shared_ptr<std::istream> const &fileStream,
+                   std::shared_ptr<ocx::stream::MappedFile> const &mappedFile,
+                   std::string &skeleton,
+                   std::vector<ocx::stream::PanelRange> &panelRanges) {
+  if (OCXContext::UsePanelIndex &&
+      ocx::stream::ReadPanelIndex(filename, panelRanges)) {
+    bool const isBuilt =
+        mappedFile != nullptr
+            ? ocx::stream::BuildSkeleton(mappedFile->Data(), panelRanges,
+                                         skeleton)
+            : ocx::stream::BuildSkeleton(*fileStream, panelRanges, skeleton);
+    if (isBuilt) {
+      return true;
+    }
+    OCX_WARN("Failed to use index of file {}, scanning the file instead",
+             filename)
+    panelRanges.clear();
+    fileStream->clear();
+    fileStream->seekg(0);
+  }
+
+  bool const isSplit =
+      mappedFile != nullptr
+          ? ocx::stream::SplitPanels(mappedFile->Data(), skeleton, panelRanges)
+          : ocx::stream::SplitPanels(*fileStream, skeleton, panelRanges);
+  if (!isSplit) {
+    OCX_ERROR("Failed to scan file {} for Panel elements", filename)
+    return false;
+  }
+  OCX_INFO("Found {} Panel elements in file {}", panelRanges.size(), filename)
+
+  if (OCXContext::UsePanelIndex) {
+    // A missing index only costs the scan on the next run
+    ocx::stream::WritePanelIndex(filename, panelRanges);
+  }
+  return true;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 Standard_Boolean OCXReader::Perform(Standard_CString filename,
                                     Handle(TDocStd_Document) doc,
                                     std::shared_ptr<OCXContext> &ctx,
@@ -42,7 +101,7 @@ Standard_Boolean OCXReader::Perform(Standard_CString filename,
     return Standard_False;
   }
 
-  if (Parse(doc, theProgress) == Standard_False) {
+  if (Parse(ctx, doc, theProgress) == Standard_False) {
     Log::Shutdown();
     return Standard_False;
   }
@@ -53,19 +112,102 @@ Standard_Boolean OCXReader::Perform(Standard_CString filename,
 
 Standard_Boolean OCXReader::ReadFile(Standard_CString filename,
                                      std::shared_ptr<OCXContext> &ctx) {
+  // Drop meta information of previously read documents
+  ocx::helper::ResetOCXMetaCache();
+
   // Load the OCX Document as DOM
-  const Handle(OSD_FileSystem) &aFileSystem =
-      OSD_FileSystem::DefaultFileSystem();
-  std::shared_ptr<std::istream> aFileStream =
-      aFileSystem->OpenIStream(filename, std::ios::in);
+  std::shared_ptr<ocx::stream::MappedFile> aMappedFile;
+  std::unique_ptr<ocx::stream::MemoryBuffer> aMappedBuffer;
+  std::shared_ptr<std::istream> aFileStream;
+  if (OCXContext::MapInputFile) {
+    // The parser reads directly from the mapped pages
+    aMappedFile = ocx::stream::MappedFile::Open(filename);
+    if (aMappedFile == nullptr) {
+      return Standard_False;
+    }
+    std::string_view data = aMappedFile->Data();
+    aMappedBuffer = std::make_unique<ocx::stream::MemoryBuffer>(
+        data.data(), data.data() + data.size());
+    aFileStream = std::make_shared<std::istream>(aMappedBuffer.get());
+  } else {
+    const Handle(OSD_FileSystem) &aFileSystem =
+        OSD_FileSystem::DefaultFileSystem();
+    aFileStream =
+        aFileSystem->OpenIStream(filename, std::ios::in | std::ios::binary);
 
-  if (aFileStream == nullptr || !aFileStream->good()) {
-    OCX_ERROR("Could not open file {} for reading", filename)
-    return Standard_False;
+    if (aFileStream == nullptr || !aFileStream->good()) {
+      OCX_ERROR("Could not open file {} for reading", filename)
+      return Standard_False;
+    }
+  }
+
+  // Decompress gzip or zstd compressed files while parsing
+  auto const compression = ocx::stream::DetectCompression(*aFileStream);
+  bool const isCompressed = compression != ocx::stream::Compression::None;
+  if (isCompressed) {
+    OCX_INFO("Decompressing {} compressed file {} while parsing",
+             compression == ocx::stream::Compression::Gzip ? "gzip" : "zstd",
+             filename)
+    aFileStream = std::make_shared<ocx::stream::DecompressStream>(aFileStream,
+                                                                  compression);
   }
 
+  unsigned int const parseThreads =
+      ocx::utils::ResolveNumThreads(OCXContext::ParseThreads);
+
+  // Streamed and parallel parsing as well as the Panel index split the
+  // document at the Panels
+  bool streamPanels = OCXContext::StreamPanels;
+  bool splitPanels =
+      streamPanels || parseThreads > 1 || OCXContext::UsePanelIndex;
+  if (splitPanels && isCompressed) {
+    // The decompressed data can not be accessed by byte range
+    OCX_WARN(
+        "Streamed or parallel parsing and indexing of Panels is not "
+        "supported for compressed files, reading the complete document "
+        "instead.")
+    streamPanels = false;
+    splitPanels = false;
+  }
+
+  // When splitting only the document without the Panel subtrees is parsed
+  // here. The Panels are parsed a few at a time while reading the Vessel,
+  // except for parallel parsing without streaming where all of them are
+  // parsed up front.
+  std::shared_ptr<ocx::stream::PanelStream> panelStream;
   LDOMParser aParser;
-  if (aParser.parse(*aFileStream, Standard_True, Standard_False)) {
+  if (splitPanels) {
+    std::string skeleton;
+    std::vector<ocx::stream::PanelRange> panelRanges;
+    if (!SplitDocument(filename, aFileStream, aMappedFile, skeleton,
+                       panelRanges)) {
+      return Standard_False;
+    }
+
+    ocx::stream::MemoryBuffer skeletonBuffer(
+        skeleton.data(), skeleton.data() + skeleton.size());
+    std::istream skeletonStream(&skeletonBuffer);
+    if (aParser.parse(skeletonStream, Standard_True, Standard_False)) {
+      TCollection_AsciiString aData;
+      aParser.GetError(aData);
+      OCX_ERROR("Failed to parse file {}\n{}", filename, aData.ToCString())
+      return Standard_False;
+    }
+
+    if (aMappedFile != nullptr) {
+      panelStream = std::make_shared<ocx::stream::PanelStream>(
+          aMappedFile, std::move(panelRanges));
+    } else {
+      panelStream = std::make_shared<ocx::stream::PanelStream>(
+          aFileStream, std::move(panelRanges));
+    }
+    panelStream->SetNumThreads(parseThreads);
+    if (!streamPanels && parseThreads > 1) {
+      OCX_INFO("Parsing {} Panel elements on {} threads", panelStream->Size(),
+               parseThreads)
+      panelStream->Preload();
+    }
+  } else if (aParser.parse(*aFileStream, Standard_True, Standard_False)) {
     TCollection_AsciiString aData;
     aParser.GetError(aData);
     OCX_ERROR("Failed to parse file {}\n{}", filename, aData.ToCString())
@@ -102,34 +244,39 @@ Standard_Boolean OCXReader::ReadFile(Standard_CString filename,
     return Standard_False;
   }
 
-  // Initialize context
+  // Create a context of its own for this document
   try {
-    OCXContext::Initialize(documentRoot, nsPrefix);
+    ctx = OCXContext::Create(documentRoot, nsPrefix);
   } catch (OCXInitializationFailedException const &e) {
     OCX_ERROR(e.what())
     return Standard_False;
   }
   OCX_INFO("Initialized context successfully")
 
-  // Assign context for usage outside ocx-reader
-  ctx = OCXContext::GetInstance();
+  if (panelStream != nullptr) {
+    ctx->RegisterPanelStream(panelStream);
+  }
 
   return Standard_True;
 }
 
 //-----------------------------------------------------------------------------
 
-Standard_Boolean OCXReader::Parse(Handle(TDocStd_Document) & doc,
+Standard_Boolean OCXReader::Parse(std::shared_ptr<OCXContext> const &ctx,
+                                  Handle(TDocStd_Document) & doc,
                                   const Message_ProgressRange &theProgress) {
+  // The readers access the context through OCXContext::GetInstance()
+  OCXContext::Scope scope(ctx);
+
   // Add the OCX document to the context
-  OCXContext::GetInstance()->OCAFDoc(doc);
+  ctx->OCAFDoc(doc);
 
   // Parse and prepare units set in the OCX document
-  OCXContext::GetInstance()->PrepareUnits();
+  ctx->PrepareUnits();
 
   // Set the OCAF root label (0:1)
-  LDOM_Element header = ocx::helper::GetFirstChild(
-      OCXContext::GetInstance()->OCXRoot(), "Header");
+  LDOM_Element header =
+      ocx::helper::GetFirstChild(ctx->OCXRoot(), ocx::utils::Atom::Header);
   TDataStd_Name::Set(doc->Main(), header.getAttribute("name").GetString());
 
   // TODO: Read ClassCatalogue
@@ -0,0 +1,129 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "ocx/internal/ocx-task-graph.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ocx::utils {
+
+TaskGraph::TaskId TaskGraph::Add(std::function<void()> fn,
+                                 std::vector<TaskId> const &dependencies) {
+  TaskId const id = m_tasks.size();
+  Task task;
+  task.fn = std::move(fn);
+  for (TaskId dependency : dependencies) {
+    if (dependency >= id) {
+      throw std::invalid_argument("TaskGraph dependency on unknown task");
+    }
+    m_tasks[dependency].dependents.push_back(id);
+    task.numDependencies++;
+  }
+  m_tasks.push_back(std::move(task));
+  return id;
+}
+
+//-----------------------------------------------------------------------------
+
+std::size_t TaskGraph::Size() const { return m_tasks.size(); }
+
+//-----------------------------------------------------------------------------
+
+void TaskGraph::Run(unsigned int numThreads) {
+  // Lowest id first, i.e. the order the tasks were added in
+  std::priority_queue<TaskId, std::vector<TaskId>, std::greater<>> ready;
+  std::vector<std::size_t> pending(m_tasks.size());
+  for (TaskId id = 0; id < m_tasks.size(); id++) {
+    pending[id] = m_tasks[id].numDependencies;
+    if (pending[id] == 0) {
+      ready.push(id);
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::size_t remaining = m_tasks.size();
+  std::size_t running = 0;
+  std::exception_ptr error;
+
+  auto worker = [&]() {
+    std::unique_lock lock(mutex);
+    while (true) {
+      cv.wait(lock, [&]() {
+        return !ready.empty() || remaining == 0 ||
+               (error != nullptr && running == 0);
+      });
+      if (remaining == 0 || error != nullptr) {
+        return;
+      }
+
+      TaskId const id = ready.top();
+      ready.pop();
+      running++;
+      lock.unlock();
+
+      std::exception_ptr taskError;
+      try {
+        m_tasks[id].fn();
+      } catch (...) {
+        taskError = std::current_exception();
+      }
+
+      lock.lock();
+      running--;
+      remaining--;
+      if (taskError != nullptr && error == nullptr) {
+        error = taskError;
+      }
+      if (error == nullptr) {
+        for (TaskId dependent : m_tasks[id].dependents) {
+          if (--pending[dependent] == 0) {
+            ready.push(dependent);
+          }
+        }
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::size_t const threadCount =
+      std::min<std::size_t>(std::max(1U, numThreads), m_tasks.size());
+  std::vector<std::thread> threads;
+  if (threadCount > 1) {
+    threads.reserve(threadCount - 1);
+    for (std::size_t i = 1; i < threadCount; i++) {
+      threads.emplace_back(worker);
+    }
+  }
+  worker();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace ocx::utils
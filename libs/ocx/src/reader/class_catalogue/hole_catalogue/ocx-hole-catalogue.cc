@@ -23,16 +23,19 @@ namespace ocx::hole_catalogue {
 
 void ReadHoleCatalogue(LDOM_Element const &catalogueN) {
   LDOM_Element holeCatalogueN =
-      ocx::helper::GetFirstChild(catalogueN, "HoleShapeCatalogue");
+      ocx::helper::GetFirstChild(catalogueN,
+                                 ocx::utils::Atom::HoleShapeCatalogue);
   if (holeCatalogueN.isNull()) {
     OCX_WARN("No HoleShapeCatalogue child node found.")
     return;
   }
 
   // Read Hole
-  LDOM_Element hole2DEle = ocx::helper::GetFirstChild(holeCatalogueN, "Hole2D");
+  LDOM_Element hole2DEle =
+      ocx::helper::GetFirstChild(holeCatalogueN, ocx::utils::Atom::Hole2D);
   while (!hole2DEle.isNull()) {
-    LDOM_Element contourEle = ocx::helper::GetFirstChild(hole2DEle, "Contour");
+    LDOM_Element contourEle =
+        ocx::helper::GetFirstChild(hole2DEle, ocx::utils::Atom::Contour);
     if (!contourEle.isNull()) {
       // TODO: HoleShapes from parametric types ( Rectangular etc.)
       // LDOM_Node curveEle = contourEle.getFirstChild();
@@ -22,7 +22,7 @@ namespace ocx::reader::class_catalogue {
 
 void ReadClassCatalogue() {
   LDOM_Element catalogueN = ocx::helper::GetFirstChild(
-      OCXContext::GetInstance()->OCXRoot(), "ClassCatalogue");
+      OCXContext::GetInstance()->OCXRoot(), ocx::utils::Atom::ClassCatalogue);
   if (catalogueN.isNull()) {
     OCX_ERROR("No ClassCatalogue child node found.")
     return;
@@ -24,7 +24,8 @@ namespace ocx::reader::class_catalogue::x_section_catalogue {
 
 void ReadXSectionCatalogue(LDOM_Element const &catalogueN) {
   LDOM_Element xSectionCatalogueN =
-      ocx::helper::GetFirstChild(catalogueN, "XSectionCatalogue");
+      ocx::helper::GetFirstChild(catalogueN,
+                                 ocx::utils::Atom::XSectionCatalogue);
   if (xSectionCatalogueN.isNull()) {
     OCX_ERROR("No XSectionCatalogue child node found.")
     return;
@@ -39,7 +40,8 @@ namespace {
 
 void ReadBarSections(LDOM_Element const &xSectionCatalogueN) {
   LDOM_Element barSectionN =
-      ocx::helper::GetFirstChild(xSectionCatalogueN, "BarSection");
+      ocx::helper::GetFirstChild(xSectionCatalogueN,
+                                 ocx::utils::Atom::BarSection);
   if (barSectionN.isNull()) {
     OCX_ERROR("No BarSection child node found in XSectionCatalogue")
     return;
@@ -75,7 +77,7 @@ void ReadFlatBar(LDOM_Element const &barSectionN) {
 
   // Read height and width
   LDOM_Element heightElement =
-      ocx::helper::GetFirstChild(barSectionN, "Height");
+      ocx::helper::GetFirstChild(barSectionN, ocx::utils::Atom::Height);
   if (heightElement.isNull()) {
     OCX_ERROR(
         "No Height child node found in ReadFlatBar with BarSection id={} "
@@ -84,7 +86,8 @@ void ReadFlatBar(LDOM_Element const &barSectionN) {
     return;
   }
 
-  LDOM_Element widthElement = ocx::helper::GetFirstChild(barSectionN, "Width");
+  LDOM_Element widthElement =
+      ocx::helper::GetFirstChild(barSectionN, ocx::utils::Atom::Width);
   if (widthElement.isNull()) {
     OCX_ERROR(
         "No Width child node found in ReadFlatBar with BarSection id={} "
@@ -32,6 +32,42 @@
 
 namespace ocx::reader::shared::curve {
 
+namespace {
+
+using CurveReader = TopoDS_Shape (*)(LDOM_Element const &);
+
+/**
+ * The readers of the curve types. The closed curves (Ellipse3D,
+ * CircumCircle3D, Circle3D) return a wire, which ends the curve.
+ */
+constexpr ocx::utils::AtomMap<CurveReader, 8> curveReaders({
+    {ocx::utils::Atom::CompositeCurve3D, &ReadCompositeCurve3D},
+    {ocx::utils::Atom::Ellipse3D, &ocx::helper::ReadAsShape<ReadEllipse3D>},
+    {ocx::utils::Atom::CircumCircle3D,
+     &ocx::helper::ReadAsShape<ReadCircumCircle3D>},
+    {ocx::utils::Atom::Circle3D, &ocx::helper::ReadAsShape<ReadCircle3D>},
+    {ocx::utils::Atom::CircumArc3D,
+     &ocx::helper::ReadAsShape<ReadCircumArc3D>},
+    {ocx::utils::Atom::Line3D, &ocx::helper::ReadAsShape<ReadLine3D>},
+    {ocx::utils::Atom::PolyLine3D, &ReadPolyLine3D},
+    {ocx::utils::Atom::NURBS3D, &ReadNURBS3D},
+});
+
+/**
+ * The readers of the curve types allowed in a CompositeCurve3D
+ */
+constexpr ocx::utils::AtomMap<CurveReader, 4> compositeCurveReaders({
+    {ocx::utils::Atom::Line3D, &ocx::helper::ReadAsShape<ReadLine3D>},
+    {ocx::utils::Atom::CircumArc3D,
+     &ocx::helper::ReadAsShape<ReadCircumArc3D>},
+    {ocx::utils::Atom::NURBS3D, &ReadNURBS3D},
+    {ocx::utils::Atom::PolyLine3D, &ReadPolyLine3D},
+});
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 TopoDS_Wire ReadCurve(LDOM_Element const &curveRootN) {
   auto meta = ocx::helper::GetOCXMeta(curveRootN);
 
@@ -45,36 +81,21 @@ TopoDS_Wire ReadCurve(LDOM_Element const &curveRootN) {
       auto edge = TopoDS_Shape();
 
       LDOM_Element curveN = (LDOM_Element &)childN;
-      std::string curveType = ocx::helper::GetLocalTagName(curveN);
-      if (curveType == "CompositeCurve3D") {
-        edge = ReadCompositeCurve3D(curveN);
-      } else if (curveType == "Ellipse3D") {
-        // By default, Ellipse3D should be a closed curve
-        return ReadEllipse3D(curveN);
-      } else if (curveType == "CircumCircle3D") {
-        // By default, CircumCircle3D should be a closed curve
-        return ReadCircumCircle3D(curveN);
-      } else if (curveType == "Circle3D") {
-        // By default, Circle3D should be a closed curve
-        return ReadCircle3D(curveN);
-      } else if (curveType == "CircumArc3D") {
-        edge = ReadCircumArc3D(curveN);
-      } else if (curveType == "Line3D") {
-        edge = ReadLine3D(curveN);
-      } else if (curveType == "PolyLine3D") {
-        edge = ReadPolyLine3D(curveN);
-      } else if (curveType == "NURBS3D") {
-        edge = ReadNURBS3D(curveN);
+      auto const curveType = ocx::helper::GetLocalTagAtom(curveN);
+      if (auto read = curveReaders.Find(curveType); read != nullptr) {
+        edge = (*read)(curveN);
       } else {
         OCX_WARN("Found unsupported curve type {} in curve {} id={} guid={}",
-                 curveType, meta->name, meta->id, meta->guid)
+                 ocx::utils::AtomName(curveType), meta->name, meta->id,
+                 meta->guid)
         childN = childN.getNextSibling();
         continue;
       }
 
       if (edge.IsNull()) {
         OCX_WARN("Failed to read curve type {} in curve {} id={} guid={}",
-                 curveType, meta->name, meta->id, meta->guid)
+                 ocx::utils::AtomName(curveType), meta->name, meta->id,
+                 meta->guid)
         childN = childN.getNextSibling();
         continue;
       }
@@ -122,20 +143,14 @@ TopoDS_Shape ReadCompositeCurve3D(LDOM_Element const &curveColN) {
       auto edge = TopoDS_Shape();
 
       LDOM_Element curveN = (LDOM_Element &)childN;
-      std::string curveType = ocx::helper::GetLocalTagName(curveN);
-      if (curveType == "Line3D") {
-        edge = ReadLine3D(curveN);
-      } else if (curveType == "CircumArc3D") {
-        edge = ReadCircumArc3D(curveN);
-      } else if (curveType == "NURBS3D") {
-        edge = ReadNURBS3D(curveN);
-      } else if (curveType == "PolyLine3D") {
-        edge = ReadPolyLine3D(curveN);
+      auto const curveType = ocx::helper::GetLocalTagAtom(curveN);
+      if (auto read = compositeCurveReaders.Find(curveType); read != nullptr) {
+        edge = (*read)(curveN);
       } else {
         OCX_ERROR(
             "Found unsupported curve type {} in CompositeCurve3D with curve "
             "id={} guid={}",
-            curveType, meta->id, meta->guid)
+            ocx::utils::AtomName(curveType), meta->id, meta->guid)
         childN = childN.getNextSibling();
         continue;
       }
@@ -144,7 +159,7 @@ TopoDS_Shape ReadCompositeCurve3D(LDOM_Element const &curveColN) {
         OCX_ERROR(
             "Failed to read curve type {} in CompositeCurve3D with curve id={} "
             "guid={}",
-            curveType, meta->id, meta->guid)
+            ocx::utils::AtomName(curveType), meta->id, meta->guid)
         childN = childN.getNextSibling();
         continue;
       }
@@ -181,7 +196,8 @@ TopoDS_Shape ReadCompositeCurve3D(LDOM_Element const &curveColN) {
 TopoDS_Wire ReadEllipse3D(LDOM_Element const &ellipseN) {
   auto meta = ocx::helper::GetOCXMeta(ellipseN);
 
-  LDOM_Element centerN = ocx::helper::GetFirstChild(ellipseN, "Center");
+  LDOM_Element centerN =
+      ocx::helper::GetFirstChild(ellipseN, ocx::utils::Atom::Center);
   if (centerN.isNull()) {
     OCX_ERROR(
         "No Center child node found in Ellipse3D with curve id={} guid={}",
@@ -190,7 +206,7 @@ TopoDS_Wire ReadEllipse3D(LDOM_Element const &ellipseN) {
   }
 
   LDOM_Element majorDiaN =
-      ocx::helper::GetFirstChild(ellipseN, "MajorDiameter");
+      ocx::helper::GetFirstChild(ellipseN, ocx::utils::Atom::MajorDiameter);
   if (majorDiaN.isNull()) {
     OCX_ERROR(
         "No MajorDiameter child node found in Ellipse3D with curve id={} "
@@ -200,7 +216,7 @@ TopoDS_Wire ReadEllipse3D(LDOM_Element const &ellipseN) {
   }
 
   LDOM_Element minorDiaN =
-      ocx::helper::GetFirstChild(ellipseN, "MinorDiameter");
+      ocx::helper::GetFirstChild(ellipseN, ocx::utils::Atom::MinorDiameter);
   if (majorDiaN.isNull()) {
     OCX_ERROR(
         "No MinorDiameter child node found in Ellipse3D with curve id={} "
@@ -209,7 +225,8 @@ TopoDS_Wire ReadEllipse3D(LDOM_Element const &ellipseN) {
     return {};
   }
 
-  LDOM_Element majorAxisN = ocx::helper::GetFirstChild(ellipseN, "MajorAxis");
+  LDOM_Element majorAxisN =
+      ocx::helper::GetFirstChild(ellipseN, ocx::utils::Atom::MajorAxis);
   if (majorAxisN.isNull()) {
     OCX_ERROR(
         "No MajorAxis child node found in Ellipse3D with curve id={} guid={}",
@@ -217,7 +234,8 @@ TopoDS_Wire ReadEllipse3D(LDOM_Element const &ellipseN) {
     return {};
   }
 
-  LDOM_Element minorAxisN = ocx::helper::GetFirstChild(ellipseN, "MinorAxis");
+  LDOM_Element minorAxisN =
+      ocx::helper::GetFirstChild(ellipseN, ocx::utils::Atom::MinorAxis);
   if (minorAxisN.isNull()) {
     OCX_ERROR(
         "No MinorAxis child node found in Ellipse3D with curve id={} guid={}",
@@ -244,7 +262,8 @@ TopoDS_Wire ReadEllipse3D(LDOM_Element const &ellipseN) {
 TopoDS_Wire ReadCircumCircle3D(LDOM_Element const &circleN) {
   auto meta = ocx::helper::GetOCXMeta(circleN);
 
-  LDOM_Element positionsN = ocx::helper::GetFirstChild(circleN, "Positions");
+  LDOM_Element positionsN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::Positions);
   if (positionsN.isNull()) {
     OCX_ERROR(
         "No Positions child node found in CircumCircle3D with curve id={} "
@@ -263,7 +282,7 @@ TopoDS_Wire ReadCircumCircle3D(LDOM_Element const &circleN) {
     if (nodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element pointN = (LDOM_Element &)childN;
 
-      if (ocx::helper::GetLocalTagName(pointN) != "Point3D") {
+      if (ocx::helper::GetLocalTagAtom(pointN) != ocx::utils::Atom::Point3D) {
         OCX_ERROR(
             "Found unsupported child node {} in CircumCircle3D/Positions with "
             "curve id={} guid={}",
@@ -302,14 +321,16 @@ TopoDS_Wire ReadCircumCircle3D(LDOM_Element const &circleN) {
 TopoDS_Wire ReadCircle3D(LDOM_Element const &circleN) {
   auto meta = ocx::helper::GetOCXMeta(circleN);
 
-  LDOM_Element centerN = ocx::helper::GetFirstChild(circleN, "Center");
+  LDOM_Element centerN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::Center);
   if (centerN.isNull()) {
     OCX_ERROR("No Center child node found in Circle3D with curve id={} guid={}",
               meta->id, meta->guid)
     return {};
   }
 
-  LDOM_Element diaN = ocx::helper::GetFirstChild(circleN, "Diameter");
+  LDOM_Element diaN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::Diameter);
   if (diaN.isNull()) {
     OCX_ERROR(
         "No Diameter child node found in Circle3D with curve id={} guid={}",
@@ -317,7 +338,8 @@ TopoDS_Wire ReadCircle3D(LDOM_Element const &circleN) {
     return {};
   }
 
-  LDOM_Element normalN = ocx::helper::GetFirstChild(circleN, "Normal");
+  LDOM_Element normalN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::Normal);
   if (normalN.isNull()) {
     OCX_ERROR("No Normal child node found in Circle3D with curve id={} guid={}",
               meta->id, meta->guid)
@@ -338,7 +360,8 @@ TopoDS_Wire ReadCircle3D(LDOM_Element const &circleN) {
 TopoDS_Edge ReadCircumArc3D(LDOM_Element const &circleN) {
   auto meta = ocx::helper::GetOCXMeta(circleN);
 
-  LDOM_Element startN = ocx::helper::GetFirstChild(circleN, "StartPoint");
+  LDOM_Element startN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::StartPoint);
   if (startN.isNull()) {
     OCX_ERROR(
         "No StartPoint child node found in CircumArc3D with curve id={} "
@@ -347,7 +370,8 @@ TopoDS_Edge ReadCircumArc3D(LDOM_Element const &circleN) {
     return {};
   }
 
-  LDOM_Element intN = ocx::helper::GetFirstChild(circleN, "IntermediatePoint");
+  LDOM_Element intN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::IntermediatePoint);
   if (intN.isNull()) {
     OCX_ERROR(
         "No IntermediatePoint child node found in CircumArc3D with curve id={} "
@@ -356,7 +380,8 @@ TopoDS_Edge ReadCircumArc3D(LDOM_Element const &circleN) {
     return {};
   }
 
-  LDOM_Element endN = ocx::helper::GetFirstChild(circleN, "EndPoint");
+  LDOM_Element endN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::EndPoint);
   if (endN.isNull()) {
     OCX_ERROR(
         "No EndPoint child node found in CircumArc3D with curve id={} guid={}",
@@ -376,7 +401,8 @@ TopoDS_Edge ReadCircumArc3D(LDOM_Element const &circleN) {
 TopoDS_Edge ReadLine3D(LDOM_Element const &lineN) {
   auto meta = ocx::helper::GetOCXMeta(lineN);
 
-  LDOM_Element startN = ocx::helper::GetFirstChild(lineN, "StartPoint");
+  LDOM_Element startN =
+      ocx::helper::GetFirstChild(lineN, ocx::utils::Atom::StartPoint);
   if (startN.isNull()) {
     OCX_ERROR(
         "No StartPoint child node found in Line3D with curve id={} guid={}",
@@ -384,7 +410,8 @@ TopoDS_Edge ReadLine3D(LDOM_Element const &lineN) {
     return {};
   }
 
-  LDOM_Element endN = ocx::helper::GetFirstChild(lineN, "EndPoint");
+  LDOM_Element endN =
+      ocx::helper::GetFirstChild(lineN, ocx::utils::Atom::EndPoint);
   if (endN.isNull()) {
     OCX_ERROR("No EndPoint child node found in Line3D with curve id={} guid={}",
               meta->id, meta->guid)
@@ -407,7 +434,8 @@ TopoDS_Shape ReadPolyLine3D(LDOM_Element const &curveN) {
 TopoDS_Shape ReadNURBS3D(LDOM_Element const &nurbs3DN) {
   auto meta = ocx::helper::GetOCXMeta(nurbs3DN);
 
-  LDOM_Element propsN = ocx::helper::GetFirstChild(nurbs3DN, "NURBSproperties");
+  LDOM_Element propsN =
+      ocx::helper::GetFirstChild(nurbs3DN, ocx::utils::Atom::NURBSproperties);
   if (propsN.isNull()) {
     OCX_ERROR("No NURBSproperties child node found in NURBS3D with curve id={}",
               meta->id)
@@ -429,7 +457,8 @@ TopoDS_Shape ReadNURBS3D(LDOM_Element const &nurbs3DN) {
       isRational)
 
   // Parse knotVector
-  LDOM_Element knotVectorN = ocx::helper::GetFirstChild(nurbs3DN, "KnotVector");
+  LDOM_Element knotVectorN =
+      ocx::helper::GetFirstChild(nurbs3DN, ocx::utils::Atom::KnotVector);
   if (knotVectorN.isNull()) {
     OCX_ERROR("No KnotVector child node found in NURBS3D with curve id={}",
               meta->id)
@@ -446,7 +475,7 @@ TopoDS_Shape ReadNURBS3D(LDOM_Element const &nurbs3DN) {
 
   // Parse control Points
   LDOM_Element controlPtListN =
-      ocx::helper::GetFirstChild(nurbs3DN, "ControlPtList");
+      ocx::helper::GetFirstChild(nurbs3DN, ocx::utils::Atom::ControlPtList);
   if (controlPtListN.isNull()) {
     OCX_ERROR("No ControlPtList child node found in NURBS3D with curve id={}",
               meta->id)
@@ -14,16 +14,32 @@
 
 #include "ocx/internal/ocx-cut-by.h"
 
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
+#include <BRepClass_FaceClassifier.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepLib_FindSurface.hxx>
 #include <BRepPrimAPI_MakePrism.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <GeomAdaptor_Surface.hxx>
 #include <GeomLProp_SLProps.hxx>
+#include <Precision.hxx>
 #include <Quantity_Color.hxx>
-#include <TDataStd_Name.hxx>
+#include <ShapeFix_Face.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
+#include <algorithm>
+#include <string>
 #include <vector>
 
 #include "occutils/occutils-boolean.h"
+#include "occutils/occutils-shape.h"
+#include "occutils/occutils-surface.h"
 #include "ocx/ocx-helper.h"
 
 namespace ocx::vessel::panel::cut_by {
@@ -31,7 +47,8 @@ namespace ocx::vessel::panel::cut_by {
 TopoDS_Shape ReadCutBy(LDOM_Element const &panelN, TopoDS_Shape &panelShape) {
   auto meta = ocx::helper::GetOCXMeta(panelN);
 
-  LDOM_Element cutByN = ocx::helper::GetFirstChild(panelN, "CutBy");
+  LDOM_Element cutByN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::CutBy);
   if (cutByN.isNull()) {
     OCX_WARN(
         "No CutBy child node found in ReadCutBy with panel id={} "
@@ -42,6 +59,13 @@ TopoDS_Shape ReadCutBy(LDOM_Element const &panelN, TopoDS_Shape &panelShape) {
 
   std::vector<TopoDS_Shape> shapes;
 
+  struct Hole {
+    TopoDS_Wire contour;
+    std::string id;
+    std::string guid;
+  };
+  std::vector<Hole> holes;
+
   LDOM_Node childN = cutByN.getFirstChild();
   while (childN != nullptr) {
     const LDOM_Node::NodeType aNodeType = childN.getNodeType();
@@ -50,8 +74,10 @@ TopoDS_Shape ReadCutBy(LDOM_Element const &panelN, TopoDS_Shape &panelShape) {
       LDOM_Element cutElementN = (LDOM_Element &)childN;
 
       auto holeContourMeta = ocx::helper::GetOCXMeta(cutElementN);
-      if (auto contourType = ocx::helper::GetLocalTagName(cutElementN);
-          contourType == "SlotContour" || contourType == "Hole2DContour") {
+      if (ocx::utils::Atom const contourType =
+              ocx::helper::GetLocalTagAtom(cutElementN);
+          contourType == ocx::utils::Atom::SlotContour ||
+          contourType == ocx::utils::Atom::Hole2DContour) {
         if (TopoDS_Wire cutContour = ReadCutGeometry(cutElementN);
             !cutContour.IsNull()) {
           // Material Design ...
@@ -59,53 +85,13 @@ TopoDS_Shape ReadCutBy(LDOM_Element const &panelN, TopoDS_Shape &panelShape) {
                                                 20.0 / 256, Quantity_TOC_RGB);
 
           // Add Contour node in OCAF
-          TDF_Label cutContourLabel =
-              OCXContext::GetInstance()->OCAFShapeTool()->AddShape(cutContour,
-                                                                   false);
-          TDataStd_Name::Set(
-              cutContourLabel,
-              ("Contour (" + std::string(holeContourMeta->id) + ")").c_str());
-          OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-              cutContourLabel, cutContourColor, XCAFDoc_ColorCurv);
-
-          // Create the solid for cutting
-          BRepBuilderAPI_MakeFace faceBuilder =
-              BRepBuilderAPI_MakeFace(cutContour);
-          TopoDS_Face const &cutFace = faceBuilder.Face();
-
-          // Get the normal of the face
-          Handle(Geom_Surface) surface = BRep_Tool::Surface(cutFace);
-          GeomLProp_SLProps surfaceProps(surface, 1, 1, 1, 0.01);
-          gp_Dir normalDirection = surfaceProps.Normal();
-
-          // Create the solid for cutting
-          TopoDS_Shape cutShape;
-          try {
-            auto solidBuilder =
-                BRepPrimAPI_MakePrism(cutFace, normalDirection, false);
-            solidBuilder.Build();
-            cutShape = solidBuilder.Shape();
-          } catch (StdFail_NotDone &e) {
-            OCX_ERROR(
-                "Failed to create cut geometry in ReadCutBy with hole contour "
-                "id={} guid={}: {}",
-                holeContourMeta->id, holeContourMeta->guid,
-                e.GetMessageString())
-            shapes.push_back(cutContour);
-            childN = childN.getNextSibling();
-            continue;
-          }
-
-          try {
-            panelShape = OCCUtils::Boolean::Cut(panelShape, cutShape);
-          } catch (StdFail_NotDone &e) {
-            OCX_ERROR(
-                "Failed to cut panel surface with cut geometry in "
-                "ReadCutBy with hole contour id={} guid={}: {}",
-                holeContourMeta->id, holeContourMeta->guid,
-                e.GetMessageString())
-          }
+          OCXContext::GetInstance()->AddOCAFShape(
+              cutContour, false,
+              "Contour (" + std::string(holeContourMeta->id) + ")",
+              cutContourColor, XCAFDoc_ColorCurv);
 
+          holes.push_back({cutContour, std::string(holeContourMeta->id),
+                           std::string(holeContourMeta->guid)});
           shapes.push_back(cutContour);
         }
       }
@@ -113,6 +99,136 @@ TopoDS_Shape ReadCutBy(LDOM_Element const &panelN, TopoDS_Shape &panelShape) {
     childN = childN.getNextSibling();
   }
 
+  // A planar surface gets the holes lying completely inside of it added as
+  // inner wires, only the remaining holes need a boolean operation
+  std::vector<Hole> remainingHoles;
+  if (!holes.empty() && OCCUtils::Shape::IsFace(panelShape) &&
+      OCCUtils::Surface::IsPlane(
+          OCCUtils::Surface::FromFace(TopoDS::Face(panelShape)))) {
+    TopoDS_Face const panelFace = TopoDS::Face(panelShape);
+    BRepBuilderAPI_MakeFace faceBuilder(panelFace);
+    std::vector<Bnd_Box> innerBoxes;
+    for (Hole const &hole : holes) {
+      // Overlapping inner wires would make an invalid face
+      Bnd_Box holeBox;
+      BRepBndLib::Add(hole.contour, holeBox);
+      bool const overlaps =
+          std::any_of(innerBoxes.begin(), innerBoxes.end(),
+                      [&](Bnd_Box const &box) { return !box.IsOut(holeBox); });
+      if (!overlaps && IsInnerWire(panelFace, hole.contour)) {
+        faceBuilder.Add(hole.contour);
+        innerBoxes.push_back(holeBox);
+      } else {
+        remainingHoles.push_back(hole);
+      }
+    }
+
+    if (!innerBoxes.empty()) {
+      bool done = false;
+      if (faceBuilder.IsDone()) {
+        // Orient the inner wires opposite to the outer one
+        ShapeFix_Face fix(faceBuilder.Face());
+        fix.Perform();
+        if (!fix.Status(ShapeExtend_FAIL)) {
+          panelShape = fix.Face();
+          done = true;
+        }
+      }
+      if (!done) {
+        OCX_WARN(
+            "Failed to add holes as inner wires in ReadCutBy with panel id={} "
+            "guid={}, cutting them instead",
+            meta->id, meta->guid)
+        remainingHoles = holes;
+      }
+    }
+  } else {
+    remainingHoles = holes;
+  }
+
+  // The remaining holes are cut out of the panel surface all at once, a
+  // boolean operation per hole would re-process the ever-growing panel
+  // surface each time
+  struct CutTool {
+    TopoDS_Shape shape;
+    std::string id;
+    std::string guid;
+  };
+  std::vector<CutTool> cutTools;
+
+  Bnd_Box panelBox;
+  if (!remainingHoles.empty()) {
+    BRepBndLib::Add(panelShape, panelBox);
+  }
+
+  for (Hole const &hole : remainingHoles) {
+    // Create the solid for cutting
+    BRepBuilderAPI_MakeFace faceBuilder = BRepBuilderAPI_MakeFace(hole.contour);
+    TopoDS_Face const &cutFace = faceBuilder.Face();
+
+    // Get the normal of the face
+    Handle(Geom_Surface) surface = BRep_Tool::Surface(cutFace);
+    GeomLProp_SLProps surfaceProps(surface, 1, 1, 1, 0.01);
+    gp_Dir normalDirection = surfaceProps.Normal();
+
+    // Skip holes which do not touch the panel surface at all. The prism
+    // starts at the contour and is infinite in normal direction.
+    Bnd_Box cutBox;
+    BRepBndLib::Add(hole.contour, cutBox);
+    cutBox.Add(normalDirection);
+    if (panelBox.IsOut(cutBox)) {
+      OCXContext::GetInstance()->CountSkippedCut();
+      continue;
+    }
+
+    // Create the solid for cutting
+    TopoDS_Shape cutShape;
+    try {
+      auto solidBuilder =
+          BRepPrimAPI_MakePrism(cutFace, normalDirection, false);
+      solidBuilder.Build();
+      cutShape = solidBuilder.Shape();
+    } catch (StdFail_NotDone &e) {
+      OCX_ERROR(
+          "Failed to create cut geometry in ReadCutBy with hole contour "
+          "id={} guid={}: {}",
+          hole.id, hole.guid, e.GetMessageString())
+      continue;
+    }
+
+    cutTools.push_back({cutShape, hole.id, hole.guid});
+  }
+
+  if (!cutTools.empty()) {
+    TopTools_ListOfShape arguments;
+    arguments.Append(panelShape);
+    TopTools_ListOfShape tools;
+    for (CutTool const &cutTool : cutTools) {
+      tools.Append(cutTool.shape);
+    }
+
+    try {
+      panelShape = OCCUtils::Boolean::Cut(arguments, tools, true);
+    } catch (StdFail_NotDone &e) {
+      OCX_WARN(
+          "Failed to cut panel surface with all cut geometries at once in "
+          "ReadCutBy with panel id={} guid={}: {}. Cutting them one by one.",
+          meta->id, meta->guid, e.GetMessageString())
+
+      // Fall back to one cut per hole, so a single bad hole only fails itself
+      for (CutTool const &cutTool : cutTools) {
+        try {
+          panelShape = OCCUtils::Boolean::Cut(panelShape, cutTool.shape);
+        } catch (StdFail_NotDone &cutError) {
+          OCX_ERROR(
+              "Failed to cut panel surface with cut geometry in "
+              "ReadCutBy with hole contour id={} guid={}: {}",
+              cutTool.id, cutTool.guid, cutError.GetMessageString())
+        }
+      }
+    }
+  }
+
   TopoDS_Compound cutByAssy;
   BRep_Builder compoundBuilder;
   compoundBuilder.MakeCompound(cutByAssy);
@@ -120,9 +236,7 @@ TopoDS_Shape ReadCutBy(LDOM_Element const &panelN, TopoDS_Shape &panelShape) {
     compoundBuilder.Add(cutByAssy, shape);
   }
 
-  TDF_Label cutByLabel =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(cutByAssy, true);
-  TDataStd_Name::Set(cutByLabel, "CutBy");
+  OCXContext::GetInstance()->AddOCAFShape(cutByAssy, true, "CutBy");
 
   return cutByAssy;
 }
@@ -133,7 +247,8 @@ namespace {
 TopoDS_Wire ReadCutGeometry(LDOM_Element const &cutElementN) {
   auto meta = ocx::helper::GetOCXMeta(cutElementN);
 
-  LDOM_Element holeRef = ocx::helper::GetFirstChild(cutElementN, "HoleRef");
+  LDOM_Element holeRef =
+      ocx::helper::GetFirstChild(cutElementN, ocx::utils::Atom::HoleRef);
   if (holeRef.isNull()) {
     OCX_ERROR(
         "No HoleRef child node found in ReadCutGeometry in CutBy "
@@ -150,7 +265,8 @@ TopoDS_Wire ReadCutGeometry(LDOM_Element const &cutElementN) {
   if (!holeShape.IsNull()) {
     // Get the transformation element
     LDOM_Element transformationEle =
-        ocx::helper::GetFirstChild(cutElementN, "Transformation");
+        ocx::helper::GetFirstChild(cutElementN,
+                                   ocx::utils::Atom::Transformation);
 
     // Read the transformation
     gp_Trsf localToGlobalTrsf =
@@ -177,6 +293,43 @@ TopoDS_Wire ReadCutGeometry(LDOM_Element const &cutElementN) {
   return {};
 }
 
+//-----------------------------------------------------------------------------
+
+bool IsInnerWire(TopoDS_Face const &face, TopoDS_Wire const &wire) {
+  double const tolerance = Precision::Approximation();
+
+  // The wire needs to lie in the plane of the face
+  BRepLib_FindSurface findPlane(wire, tolerance, Standard_True);
+  if (!findPlane.Found()) {
+    return false;
+  }
+  gp_Pln const wirePlane = GeomAdaptor_Surface(findPlane.Surface()).Plane();
+  gp_Pln const facePlane = OCCUtils::Surface::FromFace(face).Plane();
+  if (!wirePlane.Axis().IsParallel(facePlane.Axis(), Precision::Angular()) ||
+      facePlane.Distance(wirePlane.Location()) > tolerance) {
+    return false;
+  }
+
+  // The wire must not touch any boundary of the face
+  for (TopExp_Explorer explorer(face, TopAbs_WIRE); explorer.More();
+       explorer.Next()) {
+    BRepExtrema_DistShapeShape distance(wire, explorer.Current());
+    if (!distance.IsDone() || distance.Value() <= tolerance) {
+      return false;
+    }
+  }
+
+  // So it is either completely inside or completely outside of the face
+  TopExp_Explorer vertexExplorer(wire, TopAbs_VERTEX);
+  if (!vertexExplorer.More()) {
+    return false;
+  }
+  BRepClass_FaceClassifier classifier(
+      face, BRep_Tool::Pnt(TopoDS::Vertex(vertexExplorer.Current())),
+      tolerance);
+  return classifier.State() == TopAbs_IN;
+}
+
 }  // namespace
 
 }  // namespace ocx::vessel::panel::cut_by
@@ -18,7 +18,10 @@
 #include <BRep_Builder.hxx>
 #include <LDOM_Element.hxx>
 #include <TopoDS_Shape.hxx>
+#include <cmath>
+#include <functional>
 #include <list>
+#include <optional>
 
 #include "occutils/occutils-curve.h"
 #include "ocx/ocx-helper.h"
@@ -28,7 +31,8 @@ namespace ocx::reader::shared::limited_by {
 TopoDS_Shape ReadLimitedBy(LDOM_Element const &panelN) {
   auto meta = ocx::helper::GetOCXMeta(panelN);
 
-  LDOM_Element limitedByN = ocx::helper::GetFirstChild(panelN, "LimitedBy");
+  LDOM_Element limitedByN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::LimitedBy);
   if (limitedByN.isNull()) {
     OCX_ERROR("No LimitedBy child node found in id={} guid={}", meta->id,
               meta->guid)
@@ -45,11 +49,12 @@ TopoDS_Shape ReadLimitedBy(LDOM_Element const &panelN) {
       LDOM_Element aElement = (LDOM_Element &)aChildNode;
 
       auto limitedByShape = TopoDS_Shape();
-      if (ocx::helper::GetLocalTagName(aElement) == "OcxItemPtr") {
+      auto const tag = ocx::helper::GetLocalTagAtom(aElement);
+      if (tag == ocx::utils::Atom::OcxItemPtr) {
         limitedByShape = ReadOcxItemPtr(panelN, aElement);
-      } else if (ocx::helper::GetLocalTagName(aElement) == "FreeEdgeCurve3D") {
+      } else if (tag == ocx::utils::Atom::FreeEdgeCurve3D) {
         limitedByShape = ReadFreeEdgeCurve3D(aElement);
-      } else if (ocx::helper::GetLocalTagName(aElement) == "GridRef") {
+      } else if (tag == ocx::utils::Atom::GridRef) {
         limitedByShape = ReadGridRef(panelN, aElement);
       } else {
         OCX_ERROR("Found unsupported LimitedBy child node {} in id={} guid={}",
@@ -79,9 +84,7 @@ TopoDS_Shape ReadLimitedBy(LDOM_Element const &panelN) {
   }
 
   // Add LimitedBy node in OCAF
-  TDF_Label limitedByLabel =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(limitedByAssy, true);
-  TDataStd_Name::Set(limitedByLabel, "LimitedBy");
+  OCXContext::GetInstance()->AddOCAFShape(limitedByAssy, true, "LimitedBy");
 
   return limitedByAssy;
 }
@@ -114,25 +117,50 @@ TopoDS_Shape ReadOcxItemPtr(LDOM_Element const &panelN,
     return {};
   }
 
-  // Get intersection between Panel and referenced OcxItemPtr shape
-  GeomAdaptor_Surface panelShapeAdapter =
-      OCCUtils::Surface::FromFace(TopoDS::Face(panelShape));
-  if (panelShapeAdapter.Surface().IsNull()) {
-    OCX_ERROR("Failed to get surface from Panel with id={} guid={}",
-              panelMeta->id, panelMeta->guid)
+  std::optional<Bnd_Box> boundingBox = ReadBoundingBox(ocxItemPtrN);
+  if (!boundingBox.has_value()) {
+    OCX_ERROR("No BoundingBox child node found in OcxItemPtr guid={}",
+              ocxItemPtrMeta->guid)
     return {};
   }
 
-  GeomAdaptor_Surface ocxItemPtrShapeAdapter =
-      OCCUtils::Surface::FromFace(TopoDS::Face(ocxItemPtrShape));
-  if (ocxItemPtrShapeAdapter.Surface().IsNull()) {
-    OCX_ERROR("Failed to get surface from OcxItemPtr with guid={}",
-              ocxItemPtrMeta->guid)
+  // The intersection lies on both surfaces, so it can only be inside of the
+  // bounding box if both surfaces reach into it
+  if (IsOutOfBox(OCXContext::GetInstance()->LookupShapeBox(panelN),
+                 *boundingBox) ||
+      IsOutOfBox(OCXContext::GetInstance()->LookupShapeBox(ocxItemPtrN),
+                 *boundingBox)) {
+    OCX_DEBUG(
+        "Skip intersection between Panel id={} guid={} and OcxItemPtr "
+        "guid={} outside of the BoundingBox",
+        panelMeta->id, panelMeta->guid, ocxItemPtrMeta->guid)
+    OCXContext::GetInstance()->CountSkippedIntersection();
     return {};
   }
 
-  std::optional<TopoDS_Edge> limitedByShape =
-      ocx::helper::Intersection(panelShapeAdapter, ocxItemPtrShapeAdapter);
+  // Get intersection between Panel and referenced OcxItemPtr shape, shared
+  // with the referenced Panel if it is limited by this one
+  std::optional<TopoDS_Edge> limitedByShape = CachedIntersection(
+      panelN, ocxItemPtrN, 0, [&]() -> std::optional<TopoDS_Edge> {
+        GeomAdaptor_Surface panelShapeAdapter =
+            OCCUtils::Surface::FromFace(TopoDS::Face(panelShape));
+        if (panelShapeAdapter.Surface().IsNull()) {
+          OCX_ERROR("Failed to get surface from Panel with id={} guid={}",
+                    panelMeta->id, panelMeta->guid)
+          return std::nullopt;
+        }
+
+        GeomAdaptor_Surface ocxItemPtrShapeAdapter =
+            OCCUtils::Surface::FromFace(TopoDS::Face(ocxItemPtrShape));
+        if (ocxItemPtrShapeAdapter.Surface().IsNull()) {
+          OCX_ERROR("Failed to get surface from OcxItemPtr with guid={}",
+                    ocxItemPtrMeta->guid)
+          return std::nullopt;
+        }
+
+        return ocx::helper::Intersection(panelShapeAdapter,
+                                         ocxItemPtrShapeAdapter);
+      });
   if (!limitedByShape.has_value()) {
     OCX_ERROR(
         "No intersection found between Panel id={} guid={} and "
@@ -141,50 +169,24 @@ TopoDS_Shape ReadOcxItemPtr(LDOM_Element const &panelN,
     return {};
   }
 
-  // Read bounding box coordinates
-  LDOM_Element boundingBoxN =
-      ocx::helper::GetFirstChild(ocxItemPtrN, "BoundingBox");
-  if (boundingBoxN.isNull()) {
-    OCX_ERROR("No BoundingBox child node found in OcxItemPtr guid={}",
-              ocxItemPtrMeta->guid)
-    return {};
-  }
-
-  gp_Pnt min =
-      ocx::helper::ReadPoint(ocx::helper::GetFirstChild(boundingBoxN, "Min"));
-  gp_Pnt max =
-      ocx::helper::ReadPoint(ocx::helper::GetFirstChild(boundingBoxN, "Max"));
-  // Expand the bounding box coordinates by 1mm (1^-3) to avoid numerical issues
-  // when constructing the bounding box
-  min.SetX(min.X() - 1e-3);
-  min.SetY(min.Y() - 1e-3);
-  min.SetZ(min.Z() - 1e-3);
-  max.SetX(max.X() + 1e-3);
-  max.SetY(max.Y() + 1e-3);
-  max.SetZ(max.Z() + 1e-3);
-  Bnd_Box boundingBox(min, max);
-
   // Limit the intersection edge to the bounding box
   GeomAdaptor_Curve limitedByShapeAdapter =
       OCCUtils::Curve::FromEdge(*limitedByShape);
 
   std::optional<TopoDS_Edge> limitedCurve =
-      ocx::helper::CurveLimitByBoundingBox(limitedByShapeAdapter, boundingBox);
+      ocx::helper::CurveLimitByBoundingBox(limitedByShapeAdapter, *boundingBox);
   if (!limitedCurve.has_value()) {
     OCX_ERROR(
         "Failed to limit the TopoDS_Edge by given BoundingBox with Panel id={} "
         "guid={} and OcxItemPtr guid={}",
         panelMeta->id, panelMeta->guid, ocxItemPtrMeta->guid)
+    return {};
   }
 
   // Add TopoDS_Edge to the OCAF
-  TDF_Label limitedByL = OCXContext::GetInstance()->OCAFShapeTool()->AddShape(
-      *limitedCurve, false);
-  TDataStd_Name::Set(
-      limitedByL,
-      (ocxItemPtrMeta->refType + " " + ocxItemPtrMeta->guid).c_str());
-  OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-      limitedByL,
+  OCXContext::GetInstance()->AddOCAFShape(
+      *limitedCurve, false,
+      ocxItemPtrMeta->refType + " " + ocxItemPtrMeta->guid,
       Quantity_Color(20 / 256.0, 20 / 256.0, 20.0 / 256, Quantity_TOC_RGB),
       XCAFDoc_ColorCurv);
 
@@ -204,12 +206,8 @@ TopoDS_Shape ReadFreeEdgeCurve3D(LDOM_Element const &curveN) {
   }
 
   // Add TopoDS_Edge to the OCAF
-  TDF_Label limitedByL =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(curveShape, false);
-  TDataStd_Name::Set(limitedByL,
-                     ("FreeEdgeCurve3D " + std::string(meta->guid)).c_str());
-  OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-      limitedByL,
+  OCXContext::GetInstance()->AddOCAFShape(
+      curveShape, false, "FreeEdgeCurve3D " + std::string(meta->guid),
       Quantity_Color(20 / 256.0, 20 / 256.0, 20.0 / 256, Quantity_TOC_RGB),
       XCAFDoc_ColorCurv);
 
@@ -245,7 +243,8 @@ TopoDS_Shape ReadGridRef(LDOM_Element const &panelN,
 
   // Make new surface from the GridRef shape with given Offset
   // Read Offset
-  LDOM_Element offsetN = ocx::helper::GetFirstChild(gridRefN, "Offset");
+  LDOM_Element offsetN =
+      ocx::helper::GetFirstChild(gridRefN, ocx::utils::Atom::Offset);
   if (offsetN.isNull()) {
     OCX_ERROR("No Offset child node found in GridRef guid={}",
               gridRefMeta->guid)
@@ -253,37 +252,65 @@ TopoDS_Shape ReadGridRef(LDOM_Element const &panelN,
   }
   double offset = ocx::helper::ReadDimension(offsetN);
 
-  // Offset along the positive normal
-  BRepOffsetAPI_MakeOffsetShape makeOffsetShape;
-  makeOffsetShape.PerformBySimple(gridRefShape, offset);
-  if (!makeOffsetShape.IsDone()) {
-    OCX_ERROR("Failed to offset GridRef with guid={}", gridRefMeta->guid)
-    return {};
-  }
-  TopoDS_Shape gridRefOffsetShape = makeOffsetShape.Shape();
-
-  // TODO: Maybe refactor into separate GridRef SurfaceRef functions as its also
-  // TODO: used in shared/ocx-unbounded-geometry.cc
-
-  // Get intersection between Panel and referenced OcxItemPtr shape
-  GeomAdaptor_Surface panelShapeAdapter =
-      OCCUtils::Surface::FromFace(TopoDS::Face(panelShape));
-  if (panelShapeAdapter.Surface().IsNull()) {
-    OCX_ERROR("Failed to get surface from Panel with id={} guid={}",
-              panelMeta->id, panelMeta->guid)
+  std::optional<Bnd_Box> boundingBox = ReadBoundingBox(gridRefN);
+  if (!boundingBox.has_value()) {
+    OCX_ERROR("No BoundingBox child node found in GridRef guid={}",
+              gridRefMeta->guid)
     return {};
   }
 
-  GeomAdaptor_Surface gridRefShapeAdapter =
-      OCCUtils::Surface::FromFace(TopoDS::Face(gridRefOffsetShape));
-  if (gridRefShapeAdapter.Surface().IsNull()) {
-    OCX_ERROR("Failed to get surface from GridRef with guid={}",
-              gridRefMeta->guid)
+  // The intersection lies on both surfaces, so it can only be inside of the
+  // bounding box if both surfaces reach into it. The GridRef surface is moved
+  // by the offset, at most.
+  if (IsOutOfBox(OCXContext::GetInstance()->LookupShapeBox(panelN),
+                 *boundingBox) ||
+      IsOutOfBox(OCXContext::GetInstance()
+                     ->LookupShapeBox(gridRefN)
+                     .Enlarged(std::abs(offset)),
+                 *boundingBox)) {
+    OCX_DEBUG(
+        "Skip intersection between Panel id={} guid={} and GridRef guid={} "
+        "outside of the BoundingBox",
+        panelMeta->id, panelMeta->guid, gridRefMeta->guid)
+    OCXContext::GetInstance()->CountSkippedIntersection();
     return {};
   }
 
-  std::optional<TopoDS_Edge> limitedByShape =
-      ocx::helper::Intersection(panelShapeAdapter, gridRefShapeAdapter);
+  // Get intersection between Panel and the offset GridRef shape, shared with
+  // other Panels limited by the same GridRef
+  std::optional<TopoDS_Edge> limitedByShape = CachedIntersection(
+      panelN, gridRefN, offset, [&]() -> std::optional<TopoDS_Edge> {
+        // Offset along the positive normal
+        BRepOffsetAPI_MakeOffsetShape makeOffsetShape;
+        makeOffsetShape.PerformBySimple(gridRefShape, offset);
+        if (!makeOffsetShape.IsDone()) {
+          OCX_ERROR("Failed to offset GridRef with guid={}", gridRefMeta->guid)
+          return std::nullopt;
+        }
+        TopoDS_Shape gridRefOffsetShape = makeOffsetShape.Shape();
+
+        // TODO: Maybe refactor into separate GridRef SurfaceRef functions as
+        // TODO: its also used in shared/ocx-unbounded-geometry.cc
+
+        GeomAdaptor_Surface panelShapeAdapter =
+            OCCUtils::Surface::FromFace(TopoDS::Face(panelShape));
+        if (panelShapeAdapter.Surface().IsNull()) {
+          OCX_ERROR("Failed to get surface from Panel with id={} guid={}",
+                    panelMeta->id, panelMeta->guid)
+          return std::nullopt;
+        }
+
+        GeomAdaptor_Surface gridRefShapeAdapter =
+            OCCUtils::Surface::FromFace(TopoDS::Face(gridRefOffsetShape));
+        if (gridRefShapeAdapter.Surface().IsNull()) {
+          OCX_ERROR("Failed to get surface from GridRef with guid={}",
+                    gridRefMeta->guid)
+          return std::nullopt;
+        }
+
+        return ocx::helper::Intersection(panelShapeAdapter,
+                                         gridRefShapeAdapter);
+      });
   if (!limitedByShape.has_value()) {
     OCX_ERROR(
         "No intersection found between Panel id={} guid={} and "
@@ -292,55 +319,87 @@ TopoDS_Shape ReadGridRef(LDOM_Element const &panelN,
     return {};
   }
 
-  // Read bounding box coordinates
-  LDOM_Element boundingBoxN =
-      ocx::helper::GetFirstChild(gridRefN, "BoundingBox");
-  if (boundingBoxN.isNull()) {
-    OCX_ERROR("No BoundingBox child node found in GridRef guid={}",
-              gridRefMeta->guid)
-    return {};
-  }
-
-  gp_Pnt min =
-      ocx::helper::ReadPoint(ocx::helper::GetFirstChild(boundingBoxN, "Min"));
-  gp_Pnt max =
-      ocx::helper::ReadPoint(ocx::helper::GetFirstChild(boundingBoxN, "Max"));
-  // Expand the bounding box coordinates by 1mm (1^-3) to avoid numerical issues
-  // when constructing the bounding box
-  min.SetX(min.X() - 1e-3);
-  min.SetY(min.Y() - 1e-3);
-  min.SetZ(min.Z() - 1e-3);
-  max.SetX(max.X() + 1e-3);
-  max.SetY(max.Y() + 1e-3);
-  max.SetZ(max.Z() + 1e-3);
-  Bnd_Box boundingBox(min, max);
-
   // Limit the intersection edge to the bounding box
   GeomAdaptor_Curve limitedByShapeAdapter =
       OCCUtils::Curve::FromEdge(*limitedByShape);
 
   std::optional<TopoDS_Edge> limitedCurve =
-      ocx::helper::CurveLimitByBoundingBox(limitedByShapeAdapter, boundingBox);
+      ocx::helper::CurveLimitByBoundingBox(limitedByShapeAdapter, *boundingBox);
   if (!limitedCurve.has_value()) {
     OCX_ERROR(
         "Failed to limit the TopoDS_Edge by given BoundingBox with Panel id={} "
         "guid={} and GridRef guid={}",
         panelMeta->id, panelMeta->guid, gridRefMeta->guid)
+    return {};
   }
 
   // Add TopoDS_Edge to the OCAF
-  TDF_Label limitedByL = OCXContext::GetInstance()->OCAFShapeTool()->AddShape(
-      *limitedCurve, false);
-  TDataStd_Name::Set(limitedByL,
-                     (gridRefMeta->refType + " " + gridRefMeta->guid).c_str());
-  OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-      limitedByL,
+  OCXContext::GetInstance()->AddOCAFShape(
+      *limitedCurve, false, gridRefMeta->refType + " " + gridRefMeta->guid,
       Quantity_Color(20 / 256.0, 20 / 256.0, 20.0 / 256, Quantity_TOC_RGB),
       XCAFDoc_ColorCurv);
 
   return *limitedCurve;
 }
 
+//-----------------------------------------------------------------------------
+
+std::optional<TopoDS_Edge> CachedIntersection(
+    LDOM_Element const &panelN, LDOM_Element const &refN, double offset,
+    std::function<std::optional<TopoDS_Edge>()> const &intersect) {
+  auto const &panelGuid = ocx::helper::GetOCXMeta(panelN)->guidKey;
+  auto const &refGuid = ocx::helper::GetOCXMeta(refN)->guidKey;
+  if (!panelGuid.has_value() || !refGuid.has_value()) {
+    return intersect();
+  }
+
+  if (std::optional<TopoDS_Edge> cached =
+          OCXContext::GetInstance()->LookupIntersection(*panelGuid, *refGuid,
+                                                        offset);
+      cached.has_value()) {
+    if (cached->IsNull()) {
+      return std::nullopt;
+    }
+    return cached;
+  }
+
+  std::optional<TopoDS_Edge> intersection = intersect();
+  OCXContext::GetInstance()->RegisterIntersection(
+      *panelGuid, *refGuid, offset, intersection.value_or(TopoDS_Edge()));
+  return intersection;
+}
+
+bool IsOutOfBox(Bnd_Box const &shapeBox, Bnd_Box const &boundingBox) {
+  // A void box means the shape box is unknown, which must not reject anything
+  return !shapeBox.IsVoid() && shapeBox.IsOut(boundingBox);
+}
+
+//-----------------------------------------------------------------------------
+
+std::optional<Bnd_Box> ReadBoundingBox(LDOM_Element const &elementN) {
+  LDOM_Element boundingBoxN =
+      ocx::helper::GetFirstChild(elementN, ocx::utils::Atom::BoundingBox);
+  if (boundingBoxN.isNull()) {
+    return std::nullopt;
+  }
+
+  gp_Pnt min =
+      ocx::helper::ReadPoint(ocx::helper::GetFirstChild(boundingBoxN,
+                                                        ocx::utils::Atom::Min));
+  gp_Pnt max =
+      ocx::helper::ReadPoint(ocx::helper::GetFirstChild(boundingBoxN,
+                                                        ocx::utils::Atom::Max));
+  // Expand the bounding box coordinates by 1mm (1^-3) to avoid numerical issues
+  // when constructing the bounding box
+  min.SetX(min.X() - 1e-3);
+  min.SetY(min.Y() - 1e-3);
+  min.SetZ(min.Z() - 1e-3);
+  max.SetX(max.X() + 1e-3);
+  max.SetY(max.Y() + 1e-3);
+  max.SetZ(max.Z() + 1e-3);
+  return Bnd_Box(min, max);
+}
+
 }  // namespace
 
 }  // namespace ocx::reader::shared::limited_by
@@ -20,7 +20,7 @@ TopoDS_Wire ReadOuterContour(LDOM_Element const& elementN) {
   auto meta = ocx::helper::GetOCXMeta(elementN);
 
   LDOM_Element outerContourN =
-      ocx::helper::GetFirstChild(elementN, "OuterContour");
+      ocx::helper::GetFirstChild(elementN, ocx::utils::Atom::OuterContour);
   if (outerContourN.isNull()) {
     OCX_ERROR("No OuterContour child node found in element id={} guid={}",
               meta->id, meta->guid)
@@ -47,11 +47,8 @@ TopoDS_Wire ReadOuterContour(LDOM_Element const& elementN) {
       Quantity_Color(20 / 256.0, 20 / 256.0, 20.0 / 256, Quantity_TOC_RGB);
 
   // Add Contour node in OCAF
-  TDF_Label contourLabel =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(curveShape, false);
-  TDataStd_Name::Set(contourLabel, "Contour");
-  OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-      contourLabel, contourColor, XCAFDoc_ColorCurv);
+  OCXContext::GetInstance()->AddOCAFShape(curveShape, false, "Contour",
+                                          contourColor, XCAFDoc_ColorCurv);
 
   return TopoDS::Wire(curveShape);
 }
@@ -33,27 +33,41 @@
 
 namespace ocx::reader::shared::surface {
 
+namespace {
+
+using SurfaceReader = TopoDS_Shape (*)(LDOM_Element const &);
+
+/**
+ * The readers of the surface types, except SurfaceCollection which may not be
+ * nested
+ */
+constexpr ocx::utils::AtomMap<SurfaceReader, 6> surfaceReaders({
+    {ocx::utils::Atom::Cone3D, &ocx::helper::ReadAsShape<ReadCone3D>},
+    {ocx::utils::Atom::Cylinder3D, &ocx::helper::ReadAsShape<ReadCylinder3D>},
+    {ocx::utils::Atom::ExtrudedSurface,
+     &ocx::helper::ReadAsShape<ReadExtrudedSurface>},
+    {ocx::utils::Atom::NURBSSurface,
+     &ocx::helper::ReadAsShape<ReadNURBSSurface>},
+    {ocx::utils::Atom::Sphere3D, &ocx::helper::ReadAsShape<ReadSphere3D>},
+    {ocx::utils::Atom::Plane3D, &ocx::helper::ReadAsShape<ReadPlane3D>},
+});
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 TopoDS_Shape ReadSurface(LDOM_Element const &surfaceN) {
   auto meta = ocx::helper::GetOCXMeta(surfaceN);
 
-  std::string surfaceType = ocx::helper::GetLocalTagName(surfaceN);
-  if (surfaceType == "SurfaceCollection") {
+  auto const surfaceType = ocx::helper::GetLocalTagAtom(surfaceN);
+  if (surfaceType == ocx::utils::Atom::SurfaceCollection) {
     return ReadSurfaceCollection(surfaceN);
-  } else if (surfaceType == "Cone3D") {
-    return ReadCone3D(surfaceN);
-  } else if (surfaceType == "Cylinder3D") {
-    return ReadCylinder3D(surfaceN);
-  } else if (surfaceType == "ExtrudedSurface") {
-    return ReadExtrudedSurface(surfaceN);
-  } else if (surfaceType == "NURBSSurface") {
-    return ReadNURBSSurface(surfaceN);
-  } else if (surfaceType == "Sphere3D") {
-    return ReadSphere3D(surfaceN);
-  } else if (surfaceType == "Plane3D") {
-    return ReadPlane3D(surfaceN);
+  } else if (auto read = surfaceReaders.Find(surfaceType); read != nullptr) {
+    return (*read)(surfaceN);
   } else {
     OCX_ERROR("Found unsupported surface type {} in surface {} id={} guid={}",
-              surfaceType, meta->name, meta->id, meta->guid)
+              ocx::utils::AtomName(surfaceType), meta->name, meta->id,
+              meta->guid)
     return {};
   }
 }
@@ -68,7 +82,7 @@ TopoDS_Shape ReadSurfaceCollection(LDOM_Element const &surfaceColN) {
   BRepBuilderAPI_Sewing sew;
 
   LDOM_Node childN = surfaceColN.getFirstChild();
-  auto face = TopoDS_Face();
+  auto face = TopoDS_Shape();
   int numSurfaces = 0;
   while (childN != nullptr) {
     const LDOM_Node::NodeType nodeType = childN.getNodeType();
@@ -76,24 +90,14 @@ TopoDS_Shape ReadSurfaceCollection(LDOM_Element const &surfaceColN) {
     if (nodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element surfaceN = (LDOM_Element &)childN;
 
-      std::string surfaceType = ocx::helper::GetLocalTagName(surfaceN);
-      if (surfaceType == "Cone3D") {
-        face = ReadCone3D(surfaceN);
-      } else if (surfaceType == "Cylinder3D") {
-        face = ReadCylinder3D(surfaceN);
-      } else if (surfaceType == "ExtrudedSurface") {
-        face = ReadExtrudedSurface(surfaceN);
-      } else if (surfaceType == "NURBSSurface") {
-        face = ReadNURBSSurface(surfaceN);
-      } else if (surfaceType == "Sphere3D") {
-        face = ReadSphere3D(surfaceN);
-      } else if (surfaceType == "Plane3D") {
-        face = ReadPlane3D(surfaceN);
+      auto const surfaceType = ocx::helper::GetLocalTagAtom(surfaceN);
+      if (auto read = surfaceReaders.Find(surfaceType); read != nullptr) {
+        face = (*read)(surfaceN);
       } else {
         OCX_ERROR(
             "Found unsupported surface type {} in SurfaceCollection with "
             "surface id={} guid={}",
-            surfaceType, meta->id, meta->guid)
+            ocx::utils::AtomName(surfaceType), meta->id, meta->guid)
         childN = childN.getNextSibling();
         continue;
       }
@@ -102,7 +106,7 @@ TopoDS_Shape ReadSurfaceCollection(LDOM_Element const &surfaceColN) {
         OCX_ERROR(
             "Failed to read surface type {} in SurfaceCollection with surface "
             "id={} guid={}",
-            surfaceType, meta->id, meta->guid)
+            ocx::utils::AtomName(surfaceType), meta->id, meta->guid)
         childN = childN.getNextSibling();
         continue;
       }
@@ -196,7 +200,8 @@ TopoDS_Face ReadNURBSSurface(LDOM_Element const &nurbsSrfN) {
   auto meta = ocx::helper::GetOCXMeta(nurbsSrfN);
 
   LDOM_Element faceBoundaryCurveN =
-      ocx::helper::GetFirstChild(nurbsSrfN, "FaceBoundaryCurve");
+      ocx::helper::GetFirstChild(nurbsSrfN,
+                                 ocx::utils::Atom::FaceBoundaryCurve);
   if (faceBoundaryCurveN.isNull()) {
     OCX_ERROR(
         "No FaceBoundaryCurve child node found in NURBSSurface with surface "
@@ -217,7 +222,8 @@ TopoDS_Face ReadNURBSSurface(LDOM_Element const &nurbsSrfN) {
 
   // Read U_NURBS properties
   LDOM_Element uPropsN =
-      ocx::helper::GetFirstChild(nurbsSrfN, "U_NURBSproperties");
+      ocx::helper::GetFirstChild(nurbsSrfN,
+                                 ocx::utils::Atom::U_NURBSproperties);
   if (uPropsN.isNull()) {
     OCX_ERROR(
         "No U_NURBSproperties child node found in NURBSSurface with surface "
@@ -244,7 +250,8 @@ TopoDS_Face ReadNURBSSurface(LDOM_Element const &nurbsSrfN) {
 
   // Read V_NURBS properties
   LDOM_Element vPropsN =
-      ocx::helper::GetFirstChild(nurbsSrfN, "V_NURBSproperties");
+      ocx::helper::GetFirstChild(nurbsSrfN,
+                                 ocx::utils::Atom::V_NURBSproperties);
   if (vPropsN.isNull()) {
     OCX_ERROR(
         "No V_NURBSproperties child node found in NURBSSurface with surface "
@@ -271,7 +278,7 @@ TopoDS_Face ReadNURBSSurface(LDOM_Element const &nurbsSrfN) {
 
   // Parse knotVectors
   LDOM_Element uKnotVectorN =
-      ocx::helper::GetFirstChild(nurbsSrfN, "UknotVector");
+      ocx::helper::GetFirstChild(nurbsSrfN, ocx::utils::Atom::UknotVector);
   if (uKnotVectorN.isNull()) {
     OCX_ERROR(
         "No UknotVector child node found in NURBSSurface with surface id={} "
@@ -292,7 +299,7 @@ TopoDS_Face ReadNURBSSurface(LDOM_Element const &nurbsSrfN) {
   }
 
   LDOM_Element vKnotVectorN =
-      ocx::helper::GetFirstChild(nurbsSrfN, "VknotVector");
+      ocx::helper::GetFirstChild(nurbsSrfN, ocx::utils::Atom::VknotVector);
   if (uKnotVectorN.isNull()) {
     OCX_ERROR(
         "No VknotVector child node found in NURBSSurface with surface id={} "
@@ -314,7 +321,7 @@ TopoDS_Face ReadNURBSSurface(LDOM_Element const &nurbsSrfN) {
 
   // Parse control points
   LDOM_Element controlPtListN =
-      ocx::helper::GetFirstChild(nurbsSrfN, "ControlPtList");
+      ocx::helper::GetFirstChild(nurbsSrfN, ocx::utils::Atom::ControlPtList);
   if (controlPtListN.isNull()) {
     OCX_ERROR(
         "No ControlPtList child node found in NURBSSurface with surface id={} "
@@ -378,14 +385,16 @@ TopoDS_Face ReadSphere3D(LDOM_Element const &surfaceN) {
 TopoDS_Face ReadPlane3D(LDOM_Element const &surfaceN) {
   auto meta = ocx::helper::GetOCXMeta(surfaceN);
 
-  LDOM_Element originN = ocx::helper::GetFirstChild(surfaceN, "Origin");
+  LDOM_Element originN =
+      ocx::helper::GetFirstChild(surfaceN, ocx::utils::Atom::Origin);
   if (originN.isNull()) {
     OCX_ERROR("No Origin child node found in Plane3D id={} guid={}", meta->id,
               meta->guid)
     return {};
   }
 
-  LDOM_Element normalN = ocx::helper::GetFirstChild(surfaceN, "Normal");
+  LDOM_Element normalN =
+      ocx::helper::GetFirstChild(surfaceN, ocx::utils::Atom::Normal);
   if (normalN.isNull()) {
     OCX_ERROR(
         "No Normal child node found in Plane3D with surface id={} guid={}",
@@ -404,7 +413,7 @@ TopoDS_Face ReadPlane3D(LDOM_Element const &surfaceN) {
 
   TopoDS_Wire outerContour{};
   LDOM_Element faceBoundaryCurveN =
-      ocx::helper::GetFirstChild(surfaceN, "FaceBoundaryCurve");
+      ocx::helper::GetFirstChild(surfaceN, ocx::utils::Atom::FaceBoundaryCurve);
   if (!faceBoundaryCurveN.isNull()) {
     outerContour = ocx::reader::shared::curve::ReadCurve(faceBoundaryCurveN);
   } else {
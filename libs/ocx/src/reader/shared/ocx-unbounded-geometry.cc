@@ -25,7 +25,7 @@ TopoDS_Shape ReadUnboundedGeometry(LDOM_Element const &elementN) {
   auto meta = ocx::helper::GetOCXMeta(elementN);
 
   LDOM_Element unboundedGeometryN =
-      ocx::helper::GetFirstChild(elementN, "UnboundedGeometry");
+      ocx::helper::GetFirstChild(elementN, ocx::utils::Atom::UnboundedGeometry);
   if (unboundedGeometryN.isNull()) {
     OCX_ERROR("No UnboundedGeometry child node found in element id={} guid={}",
               meta->id, meta->guid)
@@ -35,13 +35,15 @@ TopoDS_Shape ReadUnboundedGeometry(LDOM_Element const &elementN) {
   // UnboundedGeometry is either a shell, a shell reference, or a grid reference
   LDOM_Element refN{};
   if (LDOM_Element gridRefN =
-          ocx::helper::GetFirstChild(unboundedGeometryN, "GridRef");
+          ocx::helper::GetFirstChild(unboundedGeometryN,
+                                     ocx::utils::Atom::GridRef);
       !gridRefN.isNull()) {
     refN = gridRefN;
     OCX_DEBUG("Using GridRef guid={} as UnboundedGeometry",
               refN.getAttribute("ocx:GUIDRef").GetString())
   } else if (LDOM_Element surfaceRefN =
-                 ocx::helper::GetFirstChild(unboundedGeometryN, "SurfaceRef");
+                 ocx::helper::GetFirstChild(unboundedGeometryN,
+                                            ocx::utils::Atom::SurfaceRef);
              !surfaceRefN.isNull()) {
     refN = surfaceRefN;
     OCX_DEBUG("Using SurfaceRef guid={} as UnboundedGeometry",
@@ -25,7 +25,7 @@ void ReadClassificationData(LDOM_Element const &vesselN) {
   OCX_INFO("Reading classification data")
 
   LDOM_Element classificationDataN =
-      ocx::helper::GetFirstChild(vesselN, "ClassificationData");
+      ocx::helper::GetFirstChild(vesselN, ocx::utils::Atom::ClassificationData);
   if (classificationDataN.isNull()) {
     OCX_WARN("No ClassificationData child node found.")
     return;
@@ -43,155 +43,172 @@ void ReadPrincipalParticulars(LDOM_Element const &classificationDataN) {
   OCX_INFO("Reading principal particular...")
 
   LDOM_Element principalParticularsN =
-      ocx::helper::GetFirstChild(classificationDataN, "PrincipalParticulars");
+      ocx::helper::GetFirstChild(classificationDataN,
+                                 ocx::utils::Atom::PrincipalParticulars);
   if (principalParticularsN.isNull()) {
     OCX_WARN("No PrincipalParticulars node found")
     return;
   }
+  // Most of the children are looked up one after another
+  ocx::helper::IndexChildren(principalParticularsN);
 
   // Read principal particular properties
   ocx::context_entities::PrincipalParticularsWrapper
       principalParticularsWrapper{};
 
   if (LDOM_Element lppN =
-          ocx::helper::GetFirstChild(principalParticularsN, "Lpp");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::Lpp);
       !lppN.isNull()) {
     principalParticularsWrapper.m_lpp = ocx::helper::ReadDimension(lppN);
   }
 
   if (LDOM_Element ruleLengthN =
-          ocx::helper::GetFirstChild(principalParticularsN, "RuleLength");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::RuleLength);
       !ruleLengthN.isNull()) {
     principalParticularsWrapper.m_ruleLength =
         ocx::helper::ReadDimension(ruleLengthN);
   }
 
   if (LDOM_Element blockCoefficientN =
-          ocx::helper::GetFirstChild(principalParticularsN, "BlockCoefficient");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::BlockCoefficient);
       !blockCoefficientN.isNull()) {
     principalParticularsWrapper.m_blockCoefficient =
         ocx::helper::ReadDimension(blockCoefficientN);
   }
 
   if (LDOM_Element fpPosN =
-          ocx::helper::GetFirstChild(principalParticularsN, "FP_Pos");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::FP_Pos);
       !fpPosN.isNull()) {
     principalParticularsWrapper.m_fpPos = ocx::helper::ReadDimension(fpPosN);
   }
 
   if (LDOM_Element mouldedBreadthN =
-          ocx::helper::GetFirstChild(principalParticularsN, "MouldedBreadth");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::MouldedBreadth);
       !mouldedBreadthN.isNull()) {
     principalParticularsWrapper.m_mouldedBreath =
         ocx::helper::ReadDimension(mouldedBreadthN);
   }
 
   if (LDOM_Element mouldedDepthN =
-          ocx::helper::GetFirstChild(principalParticularsN, "MouldedDepth");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::MouldedDepth);
       !mouldedDepthN.isNull()) {
     principalParticularsWrapper.m_mouldedDepth =
         ocx::helper::ReadDimension(mouldedDepthN);
   }
 
   if (LDOM_Element scantlingDraughtN =
-          ocx::helper::GetFirstChild(principalParticularsN, "ScantlingDraught");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::ScantlingDraught);
       !scantlingDraughtN.isNull()) {
     principalParticularsWrapper.m_scantlingDraught =
         ocx::helper::ReadDimension(scantlingDraughtN);
   }
 
   if (LDOM_Element designSpeedN =
-          ocx::helper::GetFirstChild(principalParticularsN, "DesignSpeed");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::DesignSpeed);
       !designSpeedN.isNull()) {
     principalParticularsWrapper.m_designSpeed =
         ocx::helper::ReadDimension(designSpeedN);
   }
 
   if (LDOM_Element freeboardLengthN =
-          ocx::helper::GetFirstChild(principalParticularsN, "FreeboardLength");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::FreeboardLength);
       !freeboardLengthN.isNull()) {
     principalParticularsWrapper.m_freeboardLength =
         ocx::helper::ReadDimension(freeboardLengthN);
   }
 
   if (LDOM_Element normalBallastDraughtN = ocx::helper::GetFirstChild(
-          principalParticularsN, "NormalBallastDraught");
+          principalParticularsN, ocx::utils::Atom::NormalBallastDraught);
       !normalBallastDraughtN.isNull()) {
     principalParticularsWrapper.m_normalBallastDraught =
         ocx::helper::ReadDimension(normalBallastDraughtN);
   }
 
   if (LDOM_Element heavyBallastDraughtN = ocx::helper::GetFirstChild(
-          principalParticularsN, "HeavyBallastDraught");
+          principalParticularsN, ocx::utils::Atom::HeavyBallastDraught);
       !heavyBallastDraughtN.isNull()) {
     principalParticularsWrapper.m_heavyBallastDraught =
         ocx::helper::ReadDimension(heavyBallastDraughtN);
   }
 
   if (LDOM_Element slammingDraughtEmptyFPN = ocx::helper::GetFirstChild(
-          principalParticularsN, "SlammingDraughtEmptyFP");
+          principalParticularsN, ocx::utils::Atom::SlammingDraughtEmptyFP);
       !slammingDraughtEmptyFPN.isNull()) {
     principalParticularsWrapper.m_slammingDraughtEmptyFP =
         ocx::helper::ReadDimension(slammingDraughtEmptyFPN);
   }
 
   if (LDOM_Element slammingDraughtFullFPN = ocx::helper::GetFirstChild(
-          principalParticularsN, "SlammingDraughtFullFP");
+          principalParticularsN, ocx::utils::Atom::SlammingDraughtFullFP);
       !slammingDraughtFullFPN.isNull()) {
     principalParticularsWrapper.m_slammingDraughtFullFP =
         ocx::helper::ReadDimension(slammingDraughtFullFPN);
   }
 
   if (LDOM_Element lengthOfWaterlineN = ocx::helper::GetFirstChild(
-          principalParticularsN, "LengthOfWaterline");
+          principalParticularsN, ocx::utils::Atom::LengthOfWaterline);
       !lengthOfWaterlineN.isNull()) {
     principalParticularsWrapper.m_lengthOfWaterline =
         ocx::helper::ReadDimension(lengthOfWaterlineN);
   }
 
   if (LDOM_Element freeboardDeckHeightN = ocx::helper::GetFirstChild(
-          principalParticularsN, "FreeboardDeckHeight");
+          principalParticularsN, ocx::utils::Atom::FreeboardDeckHeight);
       !freeboardDeckHeightN.isNull()) {
     principalParticularsWrapper.m_freeboardDeckHeight =
         ocx::helper::ReadDimension(freeboardDeckHeightN);
   }
 
   if (LDOM_Element apPosN =
-          ocx::helper::GetFirstChild(principalParticularsN, "AP_Pos");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::AP_Pos);
       !apPosN.isNull()) {
     principalParticularsWrapper.m_apPos = ocx::helper::ReadDimension(apPosN);
   }
 
   if (LDOM_Element deepestEquilibriumWLN = ocx::helper::GetFirstChild(
-          principalParticularsN, "DeepestEquilibriumWL");
+          principalParticularsN, ocx::utils::Atom::DeepestEquilibriumWL);
       !deepestEquilibriumWLN.isNull()) {
     principalParticularsWrapper.m_deepestEquilibriumWL =
         ocx::helper::ReadDimension(deepestEquilibriumWLN);
   }
 
   if (LDOM_Element upperDeckAreaN =
-          ocx::helper::GetFirstChild(principalParticularsN, "UpperDeckArea");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::UpperDeckArea);
       !upperDeckAreaN.isNull()) {
     principalParticularsWrapper.m_upperDeckArea =
         ocx::helper::ReadDimension(upperDeckAreaN);
   }
 
   if (LDOM_Element waterPlaneAreaN =
-          ocx::helper::GetFirstChild(principalParticularsN, "WaterPlaneArea");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::WaterPlaneArea);
       !waterPlaneAreaN.isNull()) {
     principalParticularsWrapper.m_waterPlaneArea =
         ocx::helper::ReadDimension(waterPlaneAreaN);
   }
 
   if (LDOM_Element zPosDecklineN =
-          ocx::helper::GetFirstChild(principalParticularsN, "ZPosDeckline");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::ZPosDeckline);
       !zPosDecklineN.isNull()) {
     principalParticularsWrapper.m_zPosDeckline =
         ocx::helper::ReadDimension(zPosDecklineN);
   }
 
   if (LDOM_Element speedFactorN =
-          ocx::helper::GetFirstChild(principalParticularsN, "SpeedFactor");
+          ocx::helper::GetFirstChild(principalParticularsN,
+                                     ocx::utils::Atom::SpeedFactor);
       !speedFactorN.isNull()) {
     principalParticularsWrapper.m_speedFactor =
         ocx::helper::ReadDimension(speedFactorN);
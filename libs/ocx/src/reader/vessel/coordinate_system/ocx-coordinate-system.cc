@@ -19,7 +19,6 @@
 #include <Geom_TrimmedCurve.hxx>
 #include <Quantity_Color.hxx>
 #include <Standard_Integer.hxx>
-#include <TDataStd_Name.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Compound.hxx>
 #include <gp_Pln.hxx>
@@ -36,7 +35,7 @@ void ReadCoordinateSystem(LDOM_Element const &vesselN) {
   OCX_INFO("Start reading coordinate system...")
 
   LDOM_Element coordinateSystemN =
-      ocx::helper::GetFirstChild(vesselN, "CoordinateSystem");
+      ocx::helper::GetFirstChild(vesselN, ocx::utils::Atom::CoordinateSystem);
   if (coordinateSystemN.isNull()) {
     OCX_ERROR("No CoordinateSystem child node found.")
     return;
@@ -45,7 +44,8 @@ void ReadCoordinateSystem(LDOM_Element const &vesselN) {
   // TODO: do we need to read the LocalCartesian ?
 
   LDOM_Element frameTablesN =
-      ocx::helper::GetFirstChild(coordinateSystemN, "FrameTables");
+      ocx::helper::GetFirstChild(coordinateSystemN,
+                                 ocx::utils::Atom::FrameTables);
   if (frameTablesN.isNull()) {
     OCX_ERROR("No FrameTables child node found in CoordinateSystem")
     return;
@@ -56,7 +56,8 @@ void ReadCoordinateSystem(LDOM_Element const &vesselN) {
   // TODO: Evaluate refactor with python like for "refplane", color in zip()
 
   if (LDOM_Element xRefPlanesN =
-          ocx::helper::GetFirstChild(frameTablesN, "XRefPlanes");
+          ocx::helper::GetFirstChild(frameTablesN,
+                                     ocx::utils::Atom::XRefPlanes);
       xRefPlanesN.isNull()) {
     OCX_ERROR("No XRefPlanes child node found in CoordinateSystem/FrameTables")
   } else {
@@ -68,7 +69,8 @@ void ReadCoordinateSystem(LDOM_Element const &vesselN) {
   }
 
   if (LDOM_Element yRefPlanesN =
-          ocx::helper::GetFirstChild(frameTablesN, "YRefPlanes");
+          ocx::helper::GetFirstChild(frameTablesN,
+                                     ocx::utils::Atom::YRefPlanes);
       yRefPlanesN.isNull()) {
     OCX_ERROR("No YRefPlanes child node found in CoordinateSystem/FrameTables")
   } else {
@@ -80,7 +82,8 @@ void ReadCoordinateSystem(LDOM_Element const &vesselN) {
   }
 
   if (LDOM_Element zRefPlanesN =
-          ocx::helper::GetFirstChild(frameTablesN, "ZRefPlanes");
+          ocx::helper::GetFirstChild(frameTablesN,
+                                     ocx::utils::Atom::ZRefPlanes);
       zRefPlanesN.isNull()) {
     OCX_ERROR("No ZRefPlanes child node found in CoordinateSystem/FrameTables")
   } else {
@@ -98,14 +101,14 @@ void ReadCoordinateSystem(LDOM_Element const &vesselN) {
     builder.Add(refPlanesAssy, shape);
   }
 
-  TDF_Label label =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(refPlanesAssy, true);
-  TDataStd_Name::Set(label, "Reference Planes");
+  OCXContext::GetInstance()->AddOCAFShape(refPlanesAssy, true,
+                                          "Reference Planes");
 
   // TODO: Add configure option to enable/disable reading of VesselGrid
   // Read in VesselGrid
   if (LDOM_Element vesselGridN =
-          ocx::helper::GetFirstChild(coordinateSystemN, "VesselGrid");
+          ocx::helper::GetFirstChild(coordinateSystemN,
+                                     ocx::utils::Atom::VesselGrid);
       vesselGridN.isNull()) {
     OCX_ERROR("No VesselGrid child node found.")
     return;
@@ -136,18 +139,19 @@ TopoDS_Shape ReadRefPlane(LDOM_Element const &refPlanesN,
       LDOM_Element refPlaneN = (LDOM_Element &)aChildN;
       auto meta = ocx::helper::GetOCXMeta(refPlaneN);
 
-      if (std::string refPlaneName = ocx::helper::GetLocalTagName(refPlaneN);
-          refPlaneName != "RefPlane") {
+      if (ocx::helper::GetLocalTagAtom(refPlaneN) !=
+          ocx::utils::Atom::RefPlane) {
         OCX_ERROR(
             "Unexpected node type {} found in {}, expected node type to be "
             "RefPlane",
-            refPlaneName, refPlaneTypeName)
+            ocx::helper::GetLocalTagName(refPlaneN), refPlaneTypeName)
         aChildN = aChildN.getNextSibling();
         continue;
       }
 
       LDOM_Element refLocN =
-          ocx::helper::GetFirstChild(refPlaneN, "ReferenceLocation");
+          ocx::helper::GetFirstChild(refPlaneN,
+                                     ocx::utils::Atom::ReferenceLocation);
       if (refLocN.isNull()) {
         OCX_ERROR(
             "No ReferenceLocation child node found in RefPlane {} guid={}",
@@ -216,11 +220,8 @@ TopoDS_Shape ReadRefPlane(LDOM_Element const &refPlanesN,
       OCXContext::GetInstance()->RegisterRefPlane(
           meta->guid, refPlaneType, refPlaneN, direction, pnt0, pnt1, pnt3);
 
-      TDF_Label surfaceL =
-          OCXContext::GetInstance()->OCAFShapeTool()->AddShape(surface, false);
-      TDataStd_Name::Set(surfaceL, meta->name);
-      OCXContext::GetInstance()->OCAFColorTool()->SetColor(surfaceL, color,
-                                                           XCAFDoc_ColorSurf);
+      OCXContext::GetInstance()->AddOCAFShape(surface, false, meta->name,
+                                              color, XCAFDoc_ColorSurf);
 
       refPlaneShapes.push_back(surface);
 
@@ -236,9 +237,8 @@ TopoDS_Shape ReadRefPlane(LDOM_Element const &refPlanesN,
     refPlanesBuilder.Add(refPlanesAssy, shape);
   }
 
-  TDF_Label refPlaneLabel =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(refPlanesAssy, true);
-  TDataStd_Name::Set(refPlaneLabel, refPlaneTypeName.c_str());
+  OCXContext::GetInstance()->AddOCAFShape(refPlanesAssy, true,
+                                          refPlaneTypeName);
 
   OCX_INFO("Registered {} reference planes found in {}", cntPlanes,
            refPlaneTypeName)
@@ -280,7 +280,7 @@ void ReadVesselGrid(LDOM_Element const &vesselGridN) {
     }
 
     if (LDOM_Element distanceToApN =
-            ocx::helper::GetFirstChild(gridN, "DistanceToAP");
+            ocx::helper::GetFirstChild(gridN, ocx::utils::Atom::DistanceToAP);
         !distanceToApN.isNull()) {
       gridWrapper.SetDistanceToAp(ocx::helper::ReadDimension(distanceToApN));
     }
@@ -308,13 +308,14 @@ void ReadVesselGrid(LDOM_Element const &vesselGridN) {
         Standard_Real gridPosition, spacing;
 
         if (LDOM_Element gridPositionN =
-                ocx::helper::GetFirstChild(childN, "GridPosition");
+                ocx::helper::GetFirstChild(childN,
+                                           ocx::utils::Atom::GridPosition);
             !gridPositionN.isNull()) {
           gridPosition = ocx::helper::ReadDimension(gridPositionN);
         }
 
         if (LDOM_Element spacingN =
-                ocx::helper::GetFirstChild(childN, "Spacing");
+                ocx::helper::GetFirstChild(childN, ocx::utils::Atom::Spacing);
             !spacingN.isNull()) {
           spacing = ocx::helper::ReadDimension(spacingN);
         }
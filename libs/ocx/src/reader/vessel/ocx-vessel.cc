@@ -15,38 +15,79 @@
 #include "ocx/internal/ocx-vessel.h"
 
 #include <LDOM_Element.hxx>
+#include <array>
+#include <functional>
+#include <memory>
+#include <utility>
 
+#include "ocx/internal/ocx-class-catalogue.h"
 #include "ocx/internal/ocx-classification-data.h"
 #include "ocx/internal/ocx-coordinate-system.h"
+#include "ocx/internal/ocx-ocaf-journal.h"
 #include "ocx/internal/ocx-panel.h"
+#include "ocx/internal/ocx-parallel.h"
 #include "ocx/internal/ocx-reference-surfaces.h"
-#include "ocx/internal/ocx-class-catalogue.h"
+#include "ocx/internal/ocx-task-graph.h"
 #include "ocx/ocx-context.h"
 
 namespace ocx::reader::vessel {
 
 void ReadVessel() {
-  LDOM_Element vesselN = ocx::helper::GetFirstChild(
-      OCXContext::GetInstance()->OCXRoot(), "Vessel");
+  std::shared_ptr<OCXContext> const ctx = OCXContext::GetShared();
+  LDOM_Element vesselN =
+      ocx::helper::GetFirstChild(ctx->OCXRoot(), ocx::utils::Atom::Vessel);
   if (vesselN.isNull()) {
     OCX_ERROR("No Vessel child node found.")
     return;
   }
 
+  // The parts of the Vessel are read as a task graph, independent parts are
+  // read concurrently. Each task records its OCAF shapes into a journal of
+  // its own, the journals are added to the OCAF document in the order below
+  // once all tasks are done.
+  std::array<OCAFJournal, 5> journals;
+  auto task = [&](OCAFJournal &journal, std::function<void()> fn) {
+    return [&ctx, &journal, fn = std::move(fn)]() {
+      OCXContext::Scope scope(ctx);
+      OCAFJournal::Scope journalScope(journal);
+      fn();
+    };
+  };
+
+  ocx::utils::TaskGraph graph;
+
   // Read classification data
-  ocx::reader::vessel::classification_data::ReadClassificationData(vesselN);
+  graph.Add(task(journals[0], [&]() {
+    ocx::reader::vessel::classification_data::ReadClassificationData(vesselN);
+  }));
 
-  // Read coordinate system
-  ocx::reader::vessel::coordinate_system::ReadCoordinateSystem(vesselN);
+  // Read coordinate system, the GridRefs of the Panels refer to it
+  auto coordinateSystem = graph.Add(task(journals[1], [&]() {
+    ocx::reader::vessel::coordinate_system::ReadCoordinateSystem(vesselN);
+  }));
 
-  // Read reference surfaces
-  ocx::reader::vessel::reference_surfaces::ReadReferenceSurfaces(vesselN);
+  // Read reference surfaces, the UnboundedGeometry of the Panels and Plates
+  // refer to them
+  auto referenceSurfaces = graph.Add(task(journals[2], [&]() {
+    ocx::reader::vessel::reference_surfaces::ReadReferenceSurfaces(vesselN);
+  }));
 
-  // Read Class catalogue ( material, profile, hole etc.)
+  // Read Class catalogue ( material, profile, hole etc.), the CutBy of the
+  // Panels refer to the hole shapes
+  auto classCatalogue = graph.Add(task(journals[3], []() {
+    ocx::reader::class_catalogue::ReadClassCatalogue();
+  }));
 
-  ocx::reader::class_catalogue::ReadClassCatalogue();
   // Read panels
-  ocx::reader::vessel::panel::ReadPanels(vesselN);
+  graph.Add(task(journals[4],
+                 [&]() { ocx::reader::vessel::panel::ReadPanels(vesselN); }),
+            {coordinateSystem, referenceSurfaces, classCatalogue});
+
+  graph.Run(ocx::utils::ResolveNumThreads(OCXContext::ReadThreads));
+
+  for (OCAFJournal const &journal : journals) {
+    ctx->AddOCAFShapes(journal);
+  }
 }
 
 }  // namespace ocx::reader::vessel
@@ -16,72 +16,83 @@
 
 #include <BRep_Builder.hxx>
 #include <Quantity_Color.hxx>
-#include <TDataStd_Name.hxx>
 #include <TopoDS_Compound.hxx>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "occutils/occutils-boolean.h"
 #include "ocx/internal/ocx-cut-by.h"
+#include "ocx/internal/ocx-limited-by.h"
+#include "ocx/internal/ocx-ocaf-journal.h"
+#include "ocx/internal/ocx-outer-contour.h"
 #include "ocx/internal/ocx-unbounded-geometry.h"
 
 namespace ocx::reader::vessel::panel::composed_of {
 
-TopoDS_Shape ReadComposedOf(LDOM_Element const &panelN, bool withLimitedBy) {
+std::function<TopoDS_Shape()> ReadComposedOf(LDOM_Element const &panelN) {
   auto meta = ocx::helper::GetOCXMeta(panelN);
 
-  LDOM_Element composedOfN = ocx::helper::GetFirstChild(panelN, "ComposedOf");
+  LDOM_Element composedOfN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::ComposedOf);
   if (composedOfN.isNull()) {
     OCX_ERROR(
         "No ComposedOf child node found in ReadPlates with panel id={} guid={}",
         meta->id, meta->guid)
-    return {};
+    return []() { return TopoDS_Shape(); };
   }
 
-  std::list<TopoDS_Shape> shapes;
-
-  LDOM_Node childN = composedOfN.getFirstChild();
-  while (childN != nullptr) {
-    const LDOM_Node::NodeType aNodeType = childN.getNodeType();
-    if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
-    if (aNodeType == LDOM_Node::ELEMENT_NODE) {
-      LDOM_Element elementN = (LDOM_Element &)childN;
-
-      if (ocx::helper::GetLocalTagName(elementN) == "Plate") {
-        TopoDS_Shape plate = ReadPlate(panelN, elementN, withLimitedBy);
-        if (!plate.IsNull()) {
-          shapes.push_back(plate);
-        }
+  std::vector<std::function<TopoDS_Shape()>> plates;
+  ocx::helper::ForEachChild(
+      composedOfN, ocx::utils::Atom::Plate, [&](LDOM_Element const &plateN) {
+        plates.push_back(ReadPlate(panelN, plateN));
+      });
+
+  return [plates = std::move(plates)]() {
+    std::list<TopoDS_Shape> shapes;
+    for (auto const &finishPlate : plates) {
+      if (TopoDS_Shape plate = finishPlate(); !plate.IsNull()) {
+        shapes.push_back(plate);
       }
     }
-    childN = childN.getNextSibling();
-  }
 
-  TopoDS_Compound composedOfAssy;
-  BRep_Builder compoundBuilder;
-  compoundBuilder.MakeCompound(composedOfAssy);
-  for (TopoDS_Shape const &shape : shapes) {
-    compoundBuilder.Add(composedOfAssy, shape);
-  }
+    TopoDS_Compound composedOfAssy;
+    BRep_Builder compoundBuilder;
+    compoundBuilder.MakeCompound(composedOfAssy);
+    for (TopoDS_Shape const &shape : shapes) {
+      compoundBuilder.Add(composedOfAssy, shape);
+    }
 
-  // No need to add shapes on first run if CreateLimitedBy is enabled
-  if (OCXContext::CreateLimitedBy && !withLimitedBy) {
-    return composedOfAssy;
-  }
+    OCXContext::GetInstance()->AddOCAFShape(composedOfAssy, true,
+                                            "ComposedOf");
+
+    return TopoDS_Shape(composedOfAssy);
+  };
+}
+
+//-----------------------------------------------------------------------------
 
-  TDF_Label plateLabel = OCXContext::GetInstance()->OCAFShapeTool()->AddShape(
-      composedOfAssy, true);
-  TDataStd_Name::Set(plateLabel, "ComposedOf");
+void RegisterPlateGeometries(LDOM_Element const &panelN) {
+  LDOM_Element composedOfN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::ComposedOf);
+  if (composedOfN.isNull()) {
+    return;
+  }
 
-  return composedOfAssy;
+  ocx::helper::ForEachChild(
+      composedOfN, ocx::utils::Atom::Plate, [&](LDOM_Element const &plateN) {
+        (void)RegisterPlateGeometry(panelN, plateN);
+      });
 }
 
 //-----------------------------------------------------------------------------
 
 namespace {
 
-TopoDS_Shape ReadPlate(LDOM_Element const &panelN, LDOM_Element const &plateN,
-                       bool withLimitedBy) {
+std::function<TopoDS_Shape()> ReadPlate(LDOM_Element const &panelN,
+                                        LDOM_Element const &plateN) {
   auto plateMeta = ocx::helper::GetOCXMeta(plateN);
-  auto panelMeta = ocx::helper::GetOCXMeta(plateN);
 
   std::list<TopoDS_Shape> shapes;
 
@@ -89,42 +100,7 @@ TopoDS_Shape ReadPlate(LDOM_Element const &panelN, LDOM_Element const &plateN,
   bool CreatePlateContours = OCXContext::CreatePlateContours;
   bool CreatePlateSurfaces = OCXContext::CreatePlateSurfaces;
 
-  // Read the UnboundedGeometry, only do so if no reference surface for given
-  // element can be found.
-  TopoDS_Shape unboundedGeometryShape =
-      OCXContext::GetInstance()->LookupShape(plateN);
-  if (unboundedGeometryShape.IsNull()) {
-    if (!ocx::helper::GetFirstChild(plateN, "UnboundedGeometry").isNull()) {
-      TopoDS_Shape unboundedGeometry =
-          ocx::reader::shared::unbounded_geometry::ReadUnboundedGeometry(
-              plateN);
-      if (!unboundedGeometry.IsNull()) {
-        // Register the UnboundedGeometry in the context
-        unboundedGeometryShape = unboundedGeometry;
-        OCXContext::GetInstance()->RegisterShape(plateN,
-                                                 unboundedGeometryShape);
-      } else {
-        OCX_ERROR(
-            "Failed to read UnboundedGeometry element from Plate id={} guid={}",
-            plateMeta->id, plateMeta->guid)
-      }
-    } else {
-      OCX_WARN(
-          "No UnboundedGeometry child node found in Plate element id={} "
-          "guid={}. Try reading from parent UnboundedGeometry element.",
-          plateMeta->id, plateMeta->guid)
-      // Load it from the cache, as it should be parsed already
-      unboundedGeometryShape = OCXContext::GetInstance()->LookupShape(panelN);
-      if (!unboundedGeometryShape.IsNull()) {
-        // Register the UnboundedGeometry in the context
-        OCXContext::GetInstance()->RegisterShape(plateN,
-                                                 unboundedGeometryShape);
-      } else {
-        OCX_ERROR("Failed to lookup parent ReferenceSurface id={} guid={}",
-                  panelMeta->id, panelMeta->guid)
-      }
-    }
-  }
+  TopoDS_Shape unboundedGeometryShape = RegisterPlateGeometry(panelN, plateN);
 
   // Disable PlateSurfaces if enabled and no UnboundedGeometry is found
   if (unboundedGeometryShape.IsNull() && OCXContext::CreatePlateSurfaces) {
@@ -134,9 +110,13 @@ TopoDS_Shape ReadPlate(LDOM_Element const &panelN, LDOM_Element const &plateN,
     CreatePlateSurfaces = false;
   }
 
+  // The OCAF shapes of the Plate are added once the Plate is finished
+  OCAFJournal journal;
+  OCAFJournal::Scope journalScope(journal);
+
   // Read the Contour
   auto outerContour = TopoDS_Wire();  // retain scope for CreatePlateSurfaces
-  if (CreatePlateContours && OCXContext::CreateLimitedBy == withLimitedBy) {
+  if (CreatePlateContours) {
     outerContour = ocx::reader::shared::outer_contour::ReadOuterContour(plateN);
     if (!outerContour.IsNull()) {
       shapes.push_back(outerContour);
@@ -156,8 +136,7 @@ TopoDS_Shape ReadPlate(LDOM_Element const &panelN, LDOM_Element const &plateN,
   }
 
   // Read the PlateSurface
-  if (CreatePlateSurfaces && CreatePlateContours &&
-      OCXContext::CreateLimitedBy == withLimitedBy) {
+  if (CreatePlateSurfaces && CreatePlateContours) {
     TopoDS_Shape plateSurface = ocx::helper::LimitShapeByWire(
         unboundedGeometryShape, outerContour, plateMeta->id, plateMeta->guid);
     if (!plateSurface.IsNull()) {
@@ -173,12 +152,8 @@ TopoDS_Shape ReadPlate(LDOM_Element const &panelN, LDOM_Element const &plateN,
       // Material Design ...
       auto color =
           Quantity_Color(76 / 255.0, 175 / 255.0, 80 / 255.0, Quantity_TOC_RGB);
-      TDF_Label plateSurfaceLabel =
-          OCXContext::GetInstance()->OCAFShapeTool()->AddShape(plateSurface,
-                                                               false);
-      TDataStd_Name::Set(plateSurfaceLabel, "Surface");
-      OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-          plateSurfaceLabel, color, XCAFDoc_ColorSurf);
+      OCXContext::GetInstance()->AddOCAFShape(plateSurface, false, "Surface",
+                                              color, XCAFDoc_ColorSurf);
 
       shapes.push_back(plateSurface);
     } else {
@@ -189,33 +164,78 @@ TopoDS_Shape ReadPlate(LDOM_Element const &panelN, LDOM_Element const &plateN,
     }
   }
 
-  // Handle second run: LimitedBy nodes
-  if (withLimitedBy) {
-    TopoDS_Shape limitedBy =
-        ocx::reader::shared::limited_by::ReadLimitedBy(plateN);
-    if (!limitedBy.IsNull()) {
-      shapes.push_back(limitedBy);
+  return [plateN, shapes = std::move(shapes),
+          journal = std::move(journal)]() mutable {
+    OCXContext::GetInstance()->AddOCAFShapes(journal);
+
+    // The LimitedBy refers to the surfaces of other Panels and Plates
+    if (OCXContext::CreateLimitedBy) {
+      TopoDS_Shape limitedBy =
+          ocx::reader::shared::limited_by::ReadLimitedBy(plateN);
+      if (!limitedBy.IsNull()) {
+        shapes.push_back(limitedBy);
+      }
     }
-  }
 
-  TopoDS_Compound plateAssy;
-  BRep_Builder compoundBuilder;
-  compoundBuilder.MakeCompound(plateAssy);
-  for (TopoDS_Shape const &shape : shapes) {
-    compoundBuilder.Add(plateAssy, shape);
-  }
+    TopoDS_Compound plateAssy;
+    BRep_Builder compoundBuilder;
+    compoundBuilder.MakeCompound(plateAssy);
+    for (TopoDS_Shape const &shape : shapes) {
+      compoundBuilder.Add(plateAssy, shape);
+    }
+
+    auto plateMeta = ocx::helper::GetOCXMeta(plateN);
+    OCXContext::GetInstance()->AddOCAFShape(
+        plateAssy, true, "Plate (" + std::string(plateMeta->id) + ")");
 
-  // No need to add shapes on first run if CreateLimitedBy is enabled
-  if (OCXContext::CreateLimitedBy && !withLimitedBy) {
-    return plateAssy;
+    return TopoDS_Shape(plateAssy);
+  };
+}
+
+//-----------------------------------------------------------------------------
+
+TopoDS_Shape RegisterPlateGeometry(LDOM_Element const &panelN,
+                                   LDOM_Element const &plateN) {
+  // Only read the UnboundedGeometry if no reference surface for given element
+  // can be found.
+  TopoDS_Shape unboundedGeometryShape =
+      OCXContext::GetInstance()->LookupShape(plateN);
+  if (!unboundedGeometryShape.IsNull()) {
+    return unboundedGeometryShape;
   }
 
-  TDF_Label panelLabel =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(plateAssy, true);
-  TDataStd_Name::Set(panelLabel,
-                     ("Plate (" + std::string(plateMeta->id) + ")").c_str());
+  auto plateMeta = ocx::helper::GetOCXMeta(plateN);
+  if (!ocx::helper::GetFirstChild(plateN, ocx::utils::Atom::UnboundedGeometry)
+           .isNull()) {
+    TopoDS_Shape unboundedGeometry =
+        ocx::reader::shared::unbounded_geometry::ReadUnboundedGeometry(plateN);
+    if (!unboundedGeometry.IsNull()) {
+      // Register the UnboundedGeometry in the context
+      unboundedGeometryShape = unboundedGeometry;
+      OCXContext::GetInstance()->RegisterShape(plateN, unboundedGeometryShape);
+    } else {
+      OCX_ERROR(
+          "Failed to read UnboundedGeometry element from Plate id={} guid={}",
+          plateMeta->id, plateMeta->guid)
+    }
+  } else {
+    OCX_WARN(
+        "No UnboundedGeometry child node found in Plate element id={} "
+        "guid={}. Try reading from parent UnboundedGeometry element.",
+        plateMeta->id, plateMeta->guid)
+    // Load it from the cache, as it should be parsed already
+    unboundedGeometryShape = OCXContext::GetInstance()->LookupShape(panelN);
+    if (!unboundedGeometryShape.IsNull()) {
+      // Register the UnboundedGeometry in the context
+      OCXContext::GetInstance()->RegisterShape(plateN, unboundedGeometryShape);
+    } else {
+      auto panelMeta = ocx::helper::GetOCXMeta(panelN);
+      OCX_ERROR("Failed to lookup parent ReferenceSurface id={} guid={}",
+                panelMeta->id, panelMeta->guid)
+    }
+  }
 
-  return plateAssy;
+  return unboundedGeometryShape;
 }
 
 //-----------------------------------------------------------------------------
@@ -16,14 +16,30 @@
 
 #include <BRep_Builder.hxx>
 #include <Quantity_Color.hxx>
-#include <TDataStd_Name.hxx>
 #include <TopoDS_Compound.hxx>
+#include <algorithm>
+#include <cstddef>
 #include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "occutils/occutils-boolean.h"
+#include "ocx/internal/ocx-composed-of.h"
 #include "ocx/internal/ocx-cut-by.h"
+#include "ocx/internal/ocx-limited-by.h"
 #include "ocx/internal/ocx-log.h"
+#include "ocx/internal/ocx-ocaf-journal.h"
+#include "ocx/internal/ocx-outer-contour.h"
+#include "ocx/internal/ocx-panel-stream.h"
+#include "ocx/internal/ocx-parallel.h"
 #include "ocx/internal/ocx-stiffened-by.h"
+#include "ocx/internal/ocx-task-graph.h"
+#include "ocx/internal/ocx-unbounded-geometry.h"
 #include "ocx/ocx-helper.h"
 
 namespace ocx::reader::vessel::panel {
@@ -35,47 +51,232 @@ void ReadPanels(LDOM_Element const &vesselN) {
   // ComposedOf, LimitedBy, etc.
   std::list<TopoDS_Shape> panels;
 
-  // First run without LimitedBy nodes
-  LDOM_Node aChildNode = vesselN.getFirstChild();
-  while (aChildNode != nullptr) {
-    const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
-    if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
-    if (aNodeType == LDOM_Node::ELEMENT_NODE) {
-      LDOM_Element aElement = (LDOM_Element &)aChildNode;
-
-      if (ocx::helper::GetLocalTagName(aElement) == "Panel") {
-        TopoDS_Shape panel = ReadPanel(aElement);
-        if (!panel.IsNull() && !OCXContext::CreateLimitedBy) {
-          panels.push_back(panel);
+  // Resolve the Panel selection up front. The LimitedBy of selected Panels
+  // and their Plates may reference Panels or Plates of Panels which are not
+  // selected themselves, these Panels are dependencies.
+  bool const hasSelection = !OCXContext::SelectPanelGUIDs.empty() ||
+                            !OCXContext::SelectPanelName.empty() ||
+                            OCXContext::SelectPanelBox.has_value();
+  std::set<std::string, std::less<>> selected;
+  std::set<std::string, std::less<>> dependencies;
+  std::shared_ptr<ocx::stream::PanelStream> const panelStream =
+      OCXContext::GetInstance()->GetPanelStream();
+  // Positions of the streamed Panels to read, all Panels if not set
+  std::optional<std::vector<std::size_t>> streamIndices;
+  if (hasSelection && panelStream != nullptr &&
+      !OCXContext::SelectPanelGUIDs.empty()) {
+    // Look the selected Panels and the Panels owning the elements referenced
+    // by their LimitedBy up in the index of the stream, so only these Panels
+    // are parsed
+    std::vector<std::size_t> candidates;
+    for (std::string const &guid : OCXContext::SelectPanelGUIDs) {
+      if (auto idx = panelStream->FindPanel(guid); idx.has_value()) {
+        candidates.push_back(*idx);
+      } else {
+        OCX_WARN("Selected Panel {} not found", guid)
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+
+    std::set<std::size_t> indices;
+    std::set<std::string, std::less<>> refs;
+    ForEachPanelBatch(candidates, [&](std::vector<LDOM_Element> const &batch) {
+      for (LDOM_Element const &panelN : batch) {
+        if (!IsPanelSelected(panelN)) {
+          continue;
+        }
+        std::string const key = PanelKey(panelN);
+        selected.insert(key);
+        if (auto idx = panelStream->FindPanel(key); idx.has_value()) {
+          indices.insert(*idx);
+        }
+        if (OCXContext::CreateLimitedBy) {
+          CollectPanelLimitedByRefs(panelN, refs);
+        }
+      }
+    });
+    for (std::string const &ref : refs) {
+      if (auto owner = panelStream->FindOwner(ref); owner.has_value()) {
+        ocx::stream::PanelRange const &range = panelStream->Ranges()[*owner];
+        std::string const &key = range.guid.empty() ? range.id : range.guid;
+        if (selected.count(key) == 0) {
+          dependencies.insert(key);
+          indices.insert(*owner);
         }
       }
     }
-    aChildNode = aChildNode.getNextSibling();
+    streamIndices.emplace(indices.begin(), indices.end());
+    OCX_INFO("Selected {} panels, {} more are referenced by their LimitedBy",
+             selected.size(), dependencies.size())
+  } else if (hasSelection) {
+    // Key of the Panel owning each Panel and Plate GUID
+    std::map<std::string, std::string, std::less<>> owners;
+    std::set<std::string, std::less<>> refs;
+    ForEachPanel(vesselN, [&](LDOM_Element const &panelN) {
+      std::string const key = PanelKey(panelN);
+      if (OCXContext::CreateLimitedBy) {
+        ForEachOwnedGuid(panelN, [&](std::string_view guid) {
+          owners.emplace(guid, key);
+        });
+      }
+      if (IsPanelSelected(panelN)) {
+        selected.insert(key);
+        if (OCXContext::CreateLimitedBy) {
+          CollectPanelLimitedByRefs(panelN, refs);
+        }
+      }
+    });
+    for (std::string const &ref : refs) {
+      if (auto owner = owners.find(ref);
+          owner != owners.end() && selected.count(owner->second) == 0) {
+        dependencies.insert(owner->second);
+      }
+    }
+    OCX_INFO("Selected {} panels, {} more are referenced by their LimitedBy",
+             selected.size(), dependencies.size())
   }
+  auto isSelected = [&](LDOM_Element const &panelN) {
+    return !hasSelection || selected.count(PanelKey(panelN)) > 0;
+  };
+
+  // The Panels are built in parallel, each one recording its OCAF shapes
+  // into a journal of its own. The journals are added to the OCAF document
+  // in document order afterwards, so the document does not depend on the
+  // number of threads.
+  std::shared_ptr<OCXContext> const ctx = OCXContext::GetShared();
+  unsigned int const numThreads =
+      ocx::utils::ResolveNumThreads(OCXContext::ReadThreads);
+  auto isDependency = [&](LDOM_Element const &panelN) {
+    return dependencies.count(PanelKey(panelN)) > 0;
+  };
+  auto forEachBatch =
+      [&](std::function<void(std::vector<LDOM_Element> const &)> const
+              &callback) {
+        if (streamIndices.has_value()) {
+          ForEachPanelBatch(*streamIndices, callback);
+        } else {
+          ForEachPanelBatch(vesselN, callback);
+        }
+      };
+  auto merge = [&](std::vector<OCAFJournal> const &journals,
+                   std::vector<TopoDS_Shape> const &shapes) {
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+      ctx->AddOCAFShapes(journals[i]);
+      if (!shapes[i].IsNull()) {
+        panels.push_back(shapes[i]);
+      }
+    }
+  };
+
+  if (panelStream != nullptr) {
+    // Streamed Panels are only available one batch at a time, so the
+    // surfaces referenced by the LimitedBy are registered in a cheap first
+    // run over all batches before any Panel is built
+    if (OCXContext::CreateLimitedBy) {
+      forEachBatch([&](std::vector<LDOM_Element> const &batch) {
+        ocx::utils::ParallelFor(batch.size(), numThreads, [&](std::size_t i) {
+          OCXContext::Scope scope(ctx);
+          if (isSelected(batch[i])) {
+            RegisterUnboundedGeometry(batch[i]);
+            if (OCXContext::CreateComposedOf) {
+              ocx::reader::vessel::panel::composed_of::RegisterPlateGeometries(
+                  batch[i]);
+            }
+          } else if (isDependency(batch[i])) {
+            RegisterUnboundedGeometry(batch[i]);
+            ocx::reader::vessel::panel::composed_of::RegisterPlateGeometries(
+                batch[i]);
+          }
+        });
+      });
+    }
 
-  if (panels.empty() && !OCXContext::CreateLimitedBy) {
-    OCX_WARN("No panels found.")
-    return;
-  }
+    forEachBatch([&](std::vector<LDOM_Element> const &batch) {
+      std::vector<TopoDS_Shape> shapes(batch.size());
+      std::vector<OCAFJournal> journals(batch.size());
+      ocx::utils::ParallelFor(batch.size(), numThreads, [&](std::size_t i) {
+        OCXContext::Scope scope(ctx);
+        OCAFJournal::Scope journalScope(journals[i]);
+        if (isSelected(batch[i])) {
+          shapes[i] = ReadPanel(batch[i])();
+        }
+      });
+      merge(journals, shapes);
+    });
+  } else {
+    std::vector<LDOM_Element> panelNodes;
+    ForEachPanelBatch(vesselN, [&](std::vector<LDOM_Element> const &batch) {
+      panelNodes = batch;
+    });
+
+    // Each Panel is built once. Only its LimitedBy, and the ones of its
+    // Plates, are resolved in a separate finishing task which starts as soon
+    // as the surfaces it refers to are registered.
+    std::size_t const numPanels = panelNodes.size();
+    std::vector<std::function<TopoDS_Shape()>> finishes(numPanels);
+    std::vector<TopoDS_Shape> shapes(numPanels);
+    std::vector<OCAFJournal> journals(numPanels);
+
+    ocx::utils::TaskGraph graph;
+    std::vector<ocx::utils::TaskGraph::TaskId> buildTasks(numPanels);
+    for (std::size_t i = 0; i < numPanels; i++) {
+      buildTasks[i] = graph.Add([&, i]() {
+        OCXContext::Scope scope(ctx);
+        if (isSelected(panelNodes[i])) {
+          finishes[i] = ReadPanel(panelNodes[i]);
+        } else if (isDependency(panelNodes[i])) {
+          RegisterUnboundedGeometry(panelNodes[i]);
+          ocx::reader::vessel::panel::composed_of::RegisterPlateGeometries(
+              panelNodes[i]);
+        }
+      });
+    }
 
-  // Second run with LimitedBy nodes
-  if (OCXContext::CreateLimitedBy) {
-    aChildNode = vesselN.getFirstChild();
-    while (aChildNode != nullptr) {
-      const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
-      if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
-      if (aNodeType == LDOM_Node::ELEMENT_NODE) {
-        LDOM_Element aElement = (LDOM_Element &)aChildNode;
+    // Panel owning each Panel and Plate GUID
+    std::map<std::string, std::size_t, std::less<>> owners;
+    if (OCXContext::CreateLimitedBy) {
+      for (std::size_t i = 0; i < numPanels; i++) {
+        ForEachOwnedGuid(panelNodes[i], [&](std::string_view guid) {
+          owners.emplace(guid, i);
+        });
+      }
+    }
 
-        if (ocx::helper::GetLocalTagName(aElement) == "Panel") {
-          TopoDS_Shape panel = ReadPanel(aElement, true);
-          if (!panel.IsNull()) {
-            panels.push_back(panel);
+    for (std::size_t i = 0; i < numPanels; i++) {
+      if (!isSelected(panelNodes[i])) {
+        continue;
+      }
+
+      std::vector<ocx::utils::TaskGraph::TaskId> inputs{buildTasks[i]};
+      if (OCXContext::CreateLimitedBy) {
+        std::set<std::string, std::less<>> refs;
+        CollectPanelLimitedByRefs(panelNodes[i], refs);
+        for (std::string const &ref : refs) {
+          if (auto owner = owners.find(ref);
+              owner != owners.end() && owner->second != i) {
+            inputs.push_back(buildTasks[owner->second]);
           }
         }
       }
-      aChildNode = aChildNode.getNextSibling();
+      graph.Add(
+          [&, i]() {
+            OCXContext::Scope scope(ctx);
+            OCAFJournal::Scope journalScope(journals[i]);
+            shapes[i] = finishes[i]();
+          },
+          inputs);
     }
+
+    graph.Run(numThreads);
+
+    merge(journals, shapes);
+  }
+
+  if (panels.empty() && !OCXContext::CreateLimitedBy) {
+    OCX_WARN("No panels found.")
+    return;
   }
 
   TopoDS_Compound panelsAssy;
@@ -86,18 +287,107 @@ void ReadPanels(LDOM_Element const &vesselN) {
     panelsBuilder.Add(panelsAssy, panel);
   }
 
-  TDF_Label panelsL =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(panelsAssy, true);
-  TDataStd_Name::Set(panelsL, "Panels");
+  ctx->AddOCAFShape(panelsAssy, true, "Panels");
+
+  OCX_INFO(
+      "Skipped {} LimitedBy intersections and {} CutBy holes by their "
+      "bounding boxes",
+      ctx->SkippedIntersections(), ctx->SkippedCuts())
 
   OCX_INFO("Finished reading panels...")
 }
 
 //-----------------------------------------------------------------------------
 
+void ForEachPanel(LDOM_Element const &vesselN,
+                  std::function<void(LDOM_Element const &)> const &callback) {
+  ForEachPanelBatch(vesselN, [&](std::vector<LDOM_Element> const &batch) {
+    for (LDOM_Element const &panelN : batch) {
+      callback(panelN);
+    }
+  });
+}
+
+//-----------------------------------------------------------------------------
+
+void ForEachPanelBatch(
+    LDOM_Element const &vesselN,
+    std::function<void(std::vector<LDOM_Element> const &)> const &callback) {
+  if (auto panelStream = OCXContext::GetInstance()->GetPanelStream();
+      panelStream != nullptr) {
+    // The Panel documents are released at the end of each batch
+    std::size_t const batchSize = PanelBatchSize();
+    for (std::size_t i = 0; i < panelStream->Size(); i += batchSize) {
+      HandOutBatch(panelStream->ReadPanels(i, batchSize), callback);
+    }
+    return;
+  }
+
+  std::vector<LDOM_Element> batch;
+  ocx::helper::ForEachChild(
+      vesselN, ocx::utils::Atom::Panel,
+      [&](LDOM_Element const &panelN) { batch.push_back(panelN); });
+  callback(batch);
+}
+
+//-----------------------------------------------------------------------------
+
+void ForEachPanelBatch(
+    std::vector<std::size_t> const &indices,
+    std::function<void(std::vector<LDOM_Element> const &)> const &callback) {
+  auto panelStream = OCXContext::GetInstance()->GetPanelStream();
+  if (panelStream == nullptr) {
+    return;
+  }
+
+  std::size_t const batchSize = PanelBatchSize();
+  for (std::size_t i = 0; i < indices.size(); i += batchSize) {
+    auto const first = indices.begin() + static_cast<std::ptrdiff_t>(i);
+    auto const last =
+        indices.begin() +
+        static_cast<std::ptrdiff_t>(std::min(i + batchSize, indices.size()));
+    HandOutBatch(panelStream->ReadPanels(std::vector<std::size_t>(first, last)),
+                 callback);
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+bool IsPanelSelected(LDOM_Element const &panelN) {
+  auto meta = ocx::helper::GetOCXMeta(panelN);
+
+  if (auto const &guids = OCXContext::SelectPanelGUIDs; !guids.empty()) {
+    if (std::find(guids.begin(), guids.end(), meta->guid) == guids.end() &&
+        std::find(guids.begin(), guids.end(), meta->id) == guids.end()) {
+      return false;
+    }
+  }
+
+  if (!OCXContext::SelectPanelName.empty() &&
+      !ocx::helper::GlobMatch(OCXContext::SelectPanelName, meta->name)) {
+    return false;
+  }
+
+  if (OCXContext::SelectPanelBox.has_value()) {
+    Bnd_Box contourBox = ReadContourBox(panelN);
+    if (contourBox.IsVoid()) {
+      OCX_WARN("Failed to get extent of Panel id={} guid={}, not selected",
+               meta->id, meta->guid)
+      return false;
+    }
+    if (OCXContext::SelectPanelBox->IsOut(contourBox)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
 namespace {
 
-TopoDS_Shape ReadPanel(LDOM_Element const &panelN, bool withLimitedBy) {
+std::function<TopoDS_Shape()> ReadPanel(LDOM_Element const &panelN) {
   auto meta = ocx::helper::GetOCXMeta(panelN);
 
   std::list<TopoDS_Shape> shapes;
@@ -133,117 +423,276 @@ TopoDS_Shape ReadPanel(LDOM_Element const &panelN, bool withLimitedBy) {
     }
   }
 
-  // Read the Contour
-  auto outerContour = TopoDS_Wire();  // retain scope for CreatePanelSurfaces
-  if (CreatePanelContours && OCXContext::CreateLimitedBy == withLimitedBy) {
-    outerContour = ocx::reader::shared::outer_contour::ReadOuterContour(panelN);
-    if (!outerContour.IsNull()) {
-      shapes.push_back(outerContour);
-    } else {
-      OCX_ERROR(
-          "Failed to read OuterContour in ReadPanel with panel id={} guid={}",
-          meta->id, meta->guid)
+  // The OCAF shapes of the Contour and Surface are added once the Panel is
+  // finished, ahead of the ones of the ComposedOf
+  OCAFJournal headJournal;
+  OCAFJournal stiffenersJournal;
+  std::function<TopoDS_Shape()> composedOf;
+  TopoDS_Shape stiffenedBy;
+  {
+    OCAFJournal::Scope journalScope(headJournal);
+
+    // Read the Contour
+    auto outerContour = TopoDS_Wire();  // retain scope for CreatePanelSurfaces
+    if (CreatePanelContours) {
+      outerContour =
+          ocx::reader::shared::outer_contour::ReadOuterContour(panelN);
+      if (!outerContour.IsNull()) {
+        shapes.push_back(outerContour);
+      } else {
+        OCX_ERROR(
+            "Failed to read OuterContour in ReadPanel with panel id={} guid={}",
+            meta->id, meta->guid)
+
+        // Disable PanelSurfaces and PlateSurfaces if they are enabled
+        if (OCXContext::CreatePanelSurfaces) {
+          OCX_WARN(
+              "PanelSurfaces creation is enabled but PanelContours creation "
+              "failed. Disabling PanelSurfaces.")
+          CreatePanelSurfaces = false;
+        }
+      }
+    }
 
-      // Disable PanelSurfaces and PlateSurfaces if they are enabled
-      if (OCXContext::CreatePanelSurfaces) {
-        OCX_WARN(
-            "PanelSurfaces creation is enabled but PanelContours creation "
-            "failed. Disabling PanelSurfaces.")
-        CreatePanelSurfaces = false;
+    // Create the resulting PanelSurface (UnboundedGeometry restricted by
+    // OuterContour and CutBy, where OuterContour is required)
+    if (CreatePanelSurfaces && CreatePanelContours) {
+      TopoDS_Shape panelSurface = ocx::helper::LimitShapeByWire(
+          unboundedGeometryShape, outerContour, meta->id, meta->guid);
+      if (!panelSurface.IsNull()) {
+        if (OCXContext::CreateCutBy) {
+          // Apply CutBy geometries
+          if (auto cutBy =
+                  ocx::vessel::panel::cut_by::ReadCutBy(panelN, panelSurface);
+              !cutBy.IsNull()) {
+            shapes.push_back(cutBy);
+          }
+        }
+
+        // Material Design Light Green 50 300
+        auto color = Quantity_Color(174 / 256.0, 213 / 256.0, 129.0 / 256,
+                                    Quantity_TOC_RGB);
+        OCXContext::GetInstance()->AddOCAFShape(panelSurface, false, "Surface",
+                                                color, XCAFDoc_ColorSurf);
+
+        shapes.push_back(panelSurface);
+      } else {
+        OCX_ERROR(
+            "Failed to create restricted surface (PlateSurface) in ReadPlate "
+            "with plate id={} guid={}",
+            meta->id, meta->guid)
       }
     }
   }
 
-  // TODO: Read CutBy here
+  // Read ComposedOf, the Plates record their OCAF shapes themselves
+  if (CreateComposedOf) {
+    composedOf =
+        ocx::reader::vessel::panel::composed_of::ReadComposedOf(panelN);
+  }
 
-  // Create the resulting PanelSurface (UnboundedGeometry restricted by
-  // OuterContour and CutBy, where OuterContour is required)
-  if (CreatePanelSurfaces && CreatePanelContours &&
-      OCXContext::CreateLimitedBy == withLimitedBy) {
-    TopoDS_Shape panelSurface = ocx::helper::LimitShapeByWire(
-        unboundedGeometryShape, outerContour, meta->id, meta->guid);
-    if (!panelSurface.IsNull()) {
-      if (OCXContext::CreateCutBy) {
-        // Apply CutBy geometries
-        if (auto cutBy =
-                ocx::vessel::panel::cut_by::ReadCutBy(panelN, panelSurface);
-            !cutBy.IsNull()) {
-          shapes.push_back(cutBy);
-        }
+  // Read StiffenedBy
+  if (OCXContext::CreateStiffenerTraces) {
+    OCAFJournal::Scope journalScope(stiffenersJournal);
+    stiffenedBy =
+        ocx::reader::vessel::panel::stiffened_by::ReadStiffenedBy(panelN);
+  }
+
+  return [panelN, shapes = std::move(shapes),
+          headJournal = std::move(headJournal),
+          composedOf = std::move(composedOf),
+          stiffenersJournal = std::move(stiffenersJournal),
+          stiffenedBy]() mutable {
+    auto meta = ocx::helper::GetOCXMeta(panelN);
+
+    OCXContext::GetInstance()->AddOCAFShapes(headJournal);
+
+    if (composedOf) {
+      if (TopoDS_Shape plates = composedOf(); !plates.IsNull()) {
+        shapes.push_back(plates);
+      } else {
+        OCX_ERROR(
+            "Failed to read ComposedOf in ReadPanel with panel id={} guid={}",
+            meta->id, meta->guid)
       }
+    }
 
-      // Material Design Light Green 50 300
-      auto color = Quantity_Color(174 / 256.0, 213 / 256.0, 129.0 / 256,
-                                  Quantity_TOC_RGB);
-      TDF_Label panelSurfaceLabel =
-          OCXContext::GetInstance()->OCAFShapeTool()->AddShape(panelSurface,
-                                                               false);
-      TDataStd_Name::Set(panelSurfaceLabel, "Surface");
-      OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-          panelSurfaceLabel, color, XCAFDoc_ColorSurf);
+    OCXContext::GetInstance()->AddOCAFShapes(stiffenersJournal);
+    if (!stiffenedBy.IsNull()) {
+      shapes.push_back(stiffenedBy);
+    }
 
-      shapes.push_back(panelSurface);
-    } else {
-      OCX_ERROR(
-          "Failed to create restricted surface (PlateSurface) in ReadPlate "
-          "with plate id={} guid={}",
-          meta->id, meta->guid)
+    // The LimitedBy refers to the surfaces of other Panels and Plates
+    if (OCXContext::CreateLimitedBy) {
+      TopoDS_Shape limitedBy =
+          ocx::reader::shared::limited_by::ReadLimitedBy(panelN);
+      if (!limitedBy.IsNull()) {
+        shapes.push_back(limitedBy);
+      }
+    }
+
+    TopoDS_Compound panelAssy;
+    BRep_Builder compoundBuilder;
+    compoundBuilder.MakeCompound(panelAssy);
+    for (TopoDS_Shape const &shape : shapes) {
+      compoundBuilder.Add(panelAssy, shape);
     }
+
+    OCXContext::GetInstance()->AddOCAFShape(
+        panelAssy, true,
+        "Panel " + std::string(meta->name) + " (" + std::string(meta->id) +
+            ")");
+
+    return TopoDS_Shape(panelAssy);
+  };
+}
+
+//-----------------------------------------------------------------------------
+
+Bnd_Box ReadContourBox(LDOM_Element const &panelN) {
+  Bnd_Box box;
+  LDOM_Element outerContourN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::OuterContour);
+  if (!outerContourN.isNull()) {
+    AddPointsToBox(outerContourN, box);
   }
+  return box;
+}
 
-  // Read ComposedOf
-  if (CreateComposedOf) {
-    TopoDS_Shape composedOf =
-        ocx::reader::vessel::panel::composed_of::ReadComposedOf(panelN,
-                                                                withLimitedBy);
-    if (!composedOf.IsNull()) {
-      shapes.push_back(composedOf);
-    } else {
-      OCX_ERROR(
-          "Failed to read ComposedOf in ReadPanel with panel id={} guid={}",
-          meta->id, meta->guid)
+//-----------------------------------------------------------------------------
+
+void AddPointsToBox(LDOM_Element const &elementN, Bnd_Box &box) {
+  LDOM_Node aChildNode = elementN.getFirstChild();
+  while (aChildNode != nullptr) {
+    const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
+    if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
+    if (aNodeType == LDOM_Node::ELEMENT_NODE) {
+      LDOM_Element aElement = (LDOM_Element &)aChildNode;
+
+      // Any element with X, Y and Z children is a point, e.g. Point3D,
+      // StartPoint, EndPoint or Center
+      if (!ocx::helper::GetFirstChild(aElement, ocx::utils::Atom::X).isNull()) {
+        box.Add(ocx::helper::ReadPoint(aElement));
+      } else {
+        AddPointsToBox(aElement, box);
+      }
     }
+    aChildNode = aChildNode.getNextSibling();
   }
+}
 
-  // Read StiffenedBy
-  if (OCXContext::CreateStiffenerTraces &&
-      OCXContext::CreateLimitedBy == withLimitedBy) {
-    TopoDS_Shape stiffenedBy =
-        ocx::reader::vessel::panel::stiffened_by::ReadStiffenedBy(
-            panelN, OCXContext::CreateLimitedBy == withLimitedBy);
-    if (!stiffenedBy.IsNull()) {
-      shapes.push_back(stiffenedBy);
+//-----------------------------------------------------------------------------
+
+void CollectLimitedByRefs(LDOM_Element const &panelN,
+                          std::set<std::string, std::less<>> &refs) {
+  LDOM_Element limitedByN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::LimitedBy);
+  if (limitedByN.isNull()) {
+    return;
+  }
+
+  LDOM_Node aChildNode = limitedByN.getFirstChild();
+  while (aChildNode != nullptr) {
+    const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
+    if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
+    if (aNodeType == LDOM_Node::ELEMENT_NODE) {
+      LDOM_Element aElement = (LDOM_Element &)aChildNode;
+
+      if (ocx::helper::GetLocalTagAtom(aElement) ==
+          ocx::utils::Atom::OcxItemPtr) {
+        auto meta = ocx::helper::GetOCXMeta(aElement);
+        refs.insert(meta->guid);
+      }
     }
+    aChildNode = aChildNode.getNextSibling();
   }
+}
+
+//-----------------------------------------------------------------------------
+
+void CollectPanelLimitedByRefs(LDOM_Element const &panelN,
+                               std::set<std::string, std::less<>> &refs) {
+  CollectLimitedByRefs(panelN, refs);
+  ForEachPlate(panelN, [&](LDOM_Element const &plateN) {
+    CollectLimitedByRefs(plateN, refs);
+  });
+}
+
+//-----------------------------------------------------------------------------
 
-  // Handle second run: LimitedBy nodes
-  if (withLimitedBy) {
-    TopoDS_Shape limitedBy =
-        ocx::reader::shared::limited_by::ReadLimitedBy(panelN);
-    if (!limitedBy.IsNull()) {
-      shapes.push_back(limitedBy);
+void ForEachOwnedGuid(LDOM_Element const &panelN,
+                      std::function<void(std::string_view)> const &callback) {
+  auto callGuid = [&](LDOM_Element const &elementN) {
+    if (std::string_view guid = ocx::helper::GetOCXMeta(elementN)->guid;
+        !guid.empty()) {
+      callback(guid);
     }
+  };
+  callGuid(panelN);
+  ForEachPlate(panelN, callGuid);
+}
+
+//-----------------------------------------------------------------------------
+
+void ForEachPlate(LDOM_Element const &panelN,
+                  std::function<void(LDOM_Element const &)> const &callback) {
+  LDOM_Element composedOfN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::ComposedOf);
+  if (composedOfN.isNull()) {
+    return;
   }
+  ocx::helper::ForEachChild(composedOfN, ocx::utils::Atom::Plate, callback);
+}
 
-  // No need to add shapes on first run if CreateLimitedBy is enabled
-  if (OCXContext::CreateLimitedBy && !withLimitedBy) {
-    return {};
+//-----------------------------------------------------------------------------
+
+void RegisterUnboundedGeometry(LDOM_Element const &panelN) {
+  if (!OCXContext::GetInstance()->LookupShape(panelN).IsNull()) {
+    return;
   }
 
-  TopoDS_Compound panelAssy;
-  BRep_Builder compoundBuilder;
-  compoundBuilder.MakeCompound(panelAssy);
-  for (TopoDS_Shape const &shape : shapes) {
-    compoundBuilder.Add(panelAssy, shape);
+  TopoDS_Shape unboundedGeometry =
+      ocx::reader::shared::unbounded_geometry::ReadUnboundedGeometry(panelN);
+  if (unboundedGeometry.IsNull()) {
+    auto meta = ocx::helper::GetOCXMeta(panelN);
+    OCX_ERROR(
+        "Failed to read UnboundedGeometry element from Plane id={} guid={}",
+        meta->id, meta->guid)
+    return;
   }
+  OCXContext::GetInstance()->RegisterShape(panelN, unboundedGeometry);
+}
 
-  TDF_Label panelLabel =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(panelAssy, true);
-  TDataStd_Name::Set(panelLabel, ("Panel " + std::string(meta->name) + " (" +
-                                  std::string(meta->id) + ")")
-                                     .c_str());
+//-----------------------------------------------------------------------------
+
+std::string PanelKey(LDOM_Element const &panelN) {
+  auto meta = ocx::helper::GetOCXMeta(panelN);
+  return *meta->guid != '\0' ? meta->guid : meta->id;
+}
+
+//-----------------------------------------------------------------------------
+
+std::size_t PanelBatchSize() {
+  // A few Panels per thread, for the threads parsing a batch as well as for
+  // the ones building it
+  unsigned int const numThreads =
+      std::max(ocx::utils::ResolveNumThreads(OCXContext::ParseThreads),
+               ocx::utils::ResolveNumThreads(OCXContext::ReadThreads));
+  return 4 * std::size_t{numThreads};
+}
+
+//-----------------------------------------------------------------------------
 
-  return panelAssy;
+void HandOutBatch(
+    std::vector<LDOM_Element> batch,
+    std::function<void(std::vector<LDOM_Element> const &)> const &callback) {
+  batch.erase(std::remove_if(
+                  batch.begin(), batch.end(),
+                  [](LDOM_Element const &panelN) { return panelN.isNull(); }),
+              batch.end());
+  callback(batch);
+  // The cached meta information refers to the released Panel documents
+  ocx::helper::ResetOCXMetaCache();
 }
 
 }  // namespace
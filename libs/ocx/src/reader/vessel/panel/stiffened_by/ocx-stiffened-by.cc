@@ -16,7 +16,6 @@
 
 #include <BRep_Builder.hxx>
 #include <Quantity_Color.hxx>
-#include <TDataStd_Name.hxx>
 #include <TopoDS_Compound.hxx>
 
 #include "ocx/internal/ocx-curve.h"
@@ -24,11 +23,11 @@
 
 namespace ocx::reader::vessel::panel::stiffened_by {
 
-TopoDS_Shape ReadStiffenedBy(LDOM_Element const &panelN, bool addShape) {
+TopoDS_Shape ReadStiffenedBy(LDOM_Element const &panelN) {
   auto meta = ocx::helper::GetOCXMeta(panelN);
 
   LDOM_Element stiffendedByN =
-      ocx::helper::GetFirstChild(panelN, "StiffenedBy");
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::StiffenedBy);
   if (stiffendedByN.isNull()) {
     OCX_ERROR(
         "No StiffenedBy child node found in ReadStiffenedBy with panel id={} "
@@ -46,8 +45,9 @@ TopoDS_Shape ReadStiffenedBy(LDOM_Element const &panelN, bool addShape) {
     if (aNodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element stiffenerN = (LDOM_Element &)childN;
 
-      if (ocx::helper::GetLocalTagName(stiffenerN) == "Stiffener") {
-        if (TopoDS_Shape stiffener = ReadStiffener(stiffenerN, addShape);
+      if (ocx::helper::GetLocalTagAtom(stiffenerN) ==
+          ocx::utils::Atom::Stiffener) {
+        if (TopoDS_Shape stiffener = ReadStiffener(stiffenerN);
             !stiffener.IsNull()) {
           shapes.push_back(stiffener);
         }
@@ -71,15 +71,7 @@ TopoDS_Shape ReadStiffenedBy(LDOM_Element const &panelN, bool addShape) {
     compoundBuilder.Add(stiffenersAssy, shape);
   }
 
-  // No need to add shapes on first run if CreateLimitedBy is enabled
-  if (!addShape) {
-    return stiffenersAssy;
-  }
-
-  TDF_Label stiffenedByLabel =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(stiffenersAssy,
-                                                           true);
-  TDataStd_Name::Set(stiffenedByLabel, "StiffenedBy");
+  OCXContext::GetInstance()->AddOCAFShape(stiffenersAssy, true, "StiffenedBy");
 
   return stiffenersAssy;
 }
@@ -88,10 +80,11 @@ TopoDS_Shape ReadStiffenedBy(LDOM_Element const &panelN, bool addShape) {
 
 namespace {
 
-TopoDS_Shape ReadStiffener(LDOM_Element const &stiffenerN, bool addShape) {
+TopoDS_Shape ReadStiffener(LDOM_Element const &stiffenerN) {
   auto meta = ocx::helper::GetOCXMeta(stiffenerN);
 
-  LDOM_Element traceN = ocx::helper::GetFirstChild(stiffenerN, "TraceLine");
+  LDOM_Element traceN =
+      ocx::helper::GetFirstChild(stiffenerN, ocx::utils::Atom::TraceLine);
   // Also check for <ocx:TraceLine /> node
   if (traceN.isNull() || traceN.getFirstChild().isNull()) {
     OCX_ERROR(
@@ -115,22 +108,15 @@ TopoDS_Shape ReadStiffener(LDOM_Element const &stiffenerN, bool addShape) {
 
   // TODO: Add simplified geometry representation of stiffener
 
-  // No need to add shapes on first run if CreateLimitedBy is enabled
-  if (!addShape) {
-    return trace;
-  }
-
   // material design red 50 500
   auto plateColor =
       Quantity_Color(244 / 255.0, 67 / 255.0, 54 / 255.0, Quantity_TOC_RGB);
 
-  TDF_Label label =
-      OCXContext::GetInstance()->OCAFShapeTool()->AddShape(trace, false);
-  TDataStd_Name::Set(label, ("Stiffener " + std::string(meta->id) + " (" +
-                             std::string(meta->guid) + ")")
-                                .c_str());
-  OCXContext::GetInstance()->OCAFColorTool()->SetColor(label, plateColor,
-                                                       XCAFDoc_ColorSurf);
+  OCXContext::GetInstance()->AddOCAFShape(
+      trace, false,
+      "Stiffener " + std::string(meta->id) + " (" + std::string(meta->guid) +
+          ")",
+      plateColor, XCAFDoc_ColorSurf);
 
   return trace;
 }
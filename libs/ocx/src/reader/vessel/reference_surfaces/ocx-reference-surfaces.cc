@@ -17,7 +17,6 @@
 #include <BRep_Builder.hxx>
 #include <Quantity_Color.hxx>
 #include <Quantity_TypeOfColor.hxx>
-#include <TDataStd_Name.hxx>
 #include <TopoDS_Compound.hxx>
 #include <list>
 
@@ -28,7 +27,7 @@ namespace ocx::reader::vessel::reference_surfaces {
 
 void ReadReferenceSurfaces(LDOM_Element const &vesselN) {
   LDOM_Element refSurfsN =
-      ocx::helper::GetFirstChild(vesselN, "ReferenceSurfaces");
+      ocx::helper::GetFirstChild(vesselN, ocx::utils::Atom::ReferenceSurfaces);
   if (refSurfsN.isNull()) {
     OCX_WARN("No ReferenceSurfaces child node found")
     return;
@@ -54,14 +53,10 @@ void ReadReferenceSurfaces(LDOM_Element const &vesselN) {
           // Material design teal 50 400
           auto color = Quantity_Color(38 / 255.0, 16 / 255.0, 154 / 255.0,
                                       Quantity_TOC_RGB);
-          TDF_Label surfL =
-              OCXContext::GetInstance()->OCAFShapeTool()->AddShape(
-                  referenceSurface, false);
-          TDataStd_Name::Set(
-              surfL, (std::string(meta->name) + " " + std::string(meta->guid))
-                         .c_str());
-          OCXContext::GetInstance()->OCAFColorTool()->SetColor(
-              surfL, color, XCAFDoc_ColorSurf);
+          OCXContext::GetInstance()->AddOCAFShape(
+              referenceSurface, false,
+              std::string(meta->name) + " " + std::string(meta->guid), color,
+              XCAFDoc_ColorSurf);
 
           shapes.push_back(referenceSurface);
         }
@@ -86,9 +81,8 @@ void ReadReferenceSurfaces(LDOM_Element const &vesselN) {
     compoundBuilder.Add(referenceSurfacesAssy, shape);
   }
 
-  TDF_Label refSurfL = OCXContext::GetInstance()->OCAFShapeTool()->AddShape(
-      referenceSurfacesAssy, true);
-  TDataStd_Name::Set(refSurfL, "Reference Surfaces");
+  OCXContext::GetInstance()->AddOCAFShape(referenceSurfacesAssy, true,
+                                          "Reference Surfaces");
 
   OCX_INFO("Registered {} reference surfaces", shapes.size())
 }
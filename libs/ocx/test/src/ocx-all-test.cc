@@ -18,4 +18,6 @@
 
 // The following lines pull in the real ocx-*-test.cc files.
 
+#include "test/src/ocx-guid-test.cc"
 #include "test/src/ocx-helper-test.cc"
+#include "test/src/ocx-panel-stream-test.cc"
@@ -0,0 +1,97 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-guid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "gtest/gtest.h"
+
+TEST(OCXGuidTest, ParseGuid) {
+  std::optional<ocx::utils::Guid> const guid =
+      ocx::utils::ParseGuid("1be545fd-f7e8-4750-8b11-1bf9ea083537");
+  ASSERT_TRUE(guid.has_value());
+  EXPECT_EQ(guid->hi, 0x1be545fdf7e84750ULL);
+  EXPECT_EQ(guid->lo, 0x8b111bf9ea083537ULL);
+
+  // Braces, missing hyphens and upper case digits denote the same GUID
+  EXPECT_EQ(ocx::utils::ParseGuid("{1be545fd-f7e8-4750-8b11-1bf9ea083537}"),
+            guid);
+  EXPECT_EQ(ocx::utils::ParseGuid("1be545fdf7e847508b111bf9ea083537"), guid);
+  EXPECT_EQ(ocx::utils::ParseGuid("{1BE545FD-F7E8-4750-8B11-1BF9EA083537}"),
+            guid);
+  EXPECT_EQ(ocx::utils::ParseGuid("1Be545Fd-f7E8-4750-8b11-1bF9eA083537"),
+            guid);
+}
+
+TEST(OCXGuidTest, ParseInvalidGuid) {
+  // Wrong number of digits
+  EXPECT_FALSE(ocx::utils::ParseGuid(""));
+  EXPECT_FALSE(ocx::utils::ParseGuid("{}"));
+  EXPECT_FALSE(ocx::utils::ParseGuid("1be545fd-f7e8-4750-8b11-1bf9ea08353"));
+  EXPECT_FALSE(ocx::utils::ParseGuid("1be545fd-f7e8-4750-8b11-1bf9ea0835370"));
+
+  // Invalid characters and unbalanced braces
+  EXPECT_FALSE(ocx::utils::ParseGuid("1be545fd-f7e8-4750-8b11-1bf9ea08353g"));
+  EXPECT_FALSE(ocx::utils::ParseGuid("1be545fd f7e8 4750 8b11 1bf9ea083537"));
+  EXPECT_FALSE(ocx::utils::ParseGuid("{1be545fd-f7e8-4750-8b11-1bf9ea083537"));
+  EXPECT_FALSE(ocx::utils::ParseGuid("1be545fd-f7e8-4750-8b11-1bf9ea083537}"));
+}
+
+TEST(OCXGuidTest, GuidMap) {
+  ocx::utils::GuidMap<int> map;
+  EXPECT_EQ(map.Size(), 0);
+  EXPECT_EQ(map.Find(ocx::utils::Guid{1, 2}), nullptr);
+
+  map[ocx::utils::Guid{1, 2}] = 12;
+  map[ocx::utils::Guid{2, 1}] = 21;
+  EXPECT_EQ(map.Size(), 2);
+  ASSERT_NE(map.Find(ocx::utils::Guid{1, 2}), nullptr);
+  EXPECT_EQ(*map.Find(ocx::utils::Guid{1, 2}), 12);
+  ASSERT_NE(map.Find(ocx::utils::Guid{2, 1}), nullptr);
+  EXPECT_EQ(*map.Find(ocx::utils::Guid{2, 1}), 21);
+  EXPECT_EQ(map.Find(ocx::utils::Guid{1, 1}), nullptr);
+
+  // Existing entries are returned, not added again
+  map[ocx::utils::Guid{1, 2}]++;
+  EXPECT_EQ(map.Size(), 2);
+  EXPECT_EQ(*map.Find(ocx::utils::Guid{1, 2}), 13);
+
+  map.Clear();
+  EXPECT_EQ(map.Size(), 0);
+  EXPECT_EQ(map.Find(ocx::utils::Guid{1, 2}), nullptr);
+}
+
+TEST(OCXGuidTest, GuidMapGrow) {
+  // The table starts with 64 slots and is rehashed once it is half full, so
+  // this grows it past 32, 64 and 128 entries. Keys differing only in few
+  // bits provoke collisions.
+  std::size_t const numEntries = 300;
+  ocx::utils::GuidMap<std::size_t> map;
+  for (std::size_t i = 0; i < numEntries; i++) {
+    map[ocx::utils::Guid{i, i << 32}] = i;
+    ASSERT_EQ(map.Size(), i + 1);
+  }
+
+  for (std::size_t i = 0; i < numEntries; i++) {
+    std::size_t const *value = map.Find(ocx::utils::Guid{i, i << 32});
+    ASSERT_NE(value, nullptr) << i;
+    EXPECT_EQ(*value, i);
+  }
+  EXPECT_EQ(map.Find(ocx::utils::Guid{numEntries, numEntries << 32}),
+            nullptr);
+  EXPECT_EQ(map.Find(ocx::utils::Guid{1, 1}), nullptr);
+}
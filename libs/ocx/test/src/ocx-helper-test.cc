@@ -14,8 +14,29 @@
 
 #include "ocx/ocx-helper.h"
 
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BRepAdaptor_Curve.hxx"
 #include "BSplCLib.hxx"
+#include "GeomAdaptor_Surface.hxx"
+#include "Geom_BSplineSurface.hxx"
+#include "Geom_Plane.hxx"
+#include "Precision.hxx"
+#include "TColStd_Array1OfInteger.hxx"
+#include "TColStd_Array1OfReal.hxx"
+#include "TColgp_Array2OfPnt.hxx"
+#include "TopoDS_Edge.hxx"
 #include "gtest/gtest.h"
+#include "ocx/internal/ocx-numeric.h"
+#include "ocx/internal/ocx-parallel.h"
+#include "ocx/internal/ocx-task-graph.h"
 
 TEST(OCXHelperTest, ParseKnotVector) {
   struct TestCase {
@@ -72,4 +93,188 @@ TEST(OCXHelperTest, ParseKnotVectorIsNull) {
       << knots.IsNull;
 }
 
+TEST(OCXHelperTest, ParseKnotVectorClamped) {
+  // Clamped knot vector of a large hull surface: 2000 distinct knots with
+  // multiplicity 4 at both ends
+  int const numUnique = 2000;
+  std::string knotVector;
+  for (int i = 0; i < numUnique; i++) {
+    int const mult = (i == 0 || i == numUnique - 1) ? 4 : 1;
+    for (int m = 0; m < mult; m++) {
+      knotVector += std::to_string(i * 0.125) + " ";
+    }
+  }
+  int const numKnots = numUnique + 6;
+
+  ocx::helper::KnotMults knots =
+      ocx::helper::ParseKnotVector(knotVector, numKnots);
+  ASSERT_FALSE(knots.IsNull);
+  ASSERT_EQ(numUnique, knots.knots.Length());
+  ASSERT_EQ(numUnique, knots.mults.Length());
+
+  int multsSum = 0;
+  for (int i = 1; i <= numUnique; i++) {
+    EXPECT_DOUBLE_EQ((i - 1) * 0.125, knots.knots[i]) << i;
+    EXPECT_EQ((i == 1 || i == numUnique) ? 4 : 1, knots.mults[i]) << i;
+    multsSum += knots.mults[i];
+  }
+  EXPECT_EQ(numKnots, multsSum);
+
+  // Degree 3 as the end multiplicities suggest
+  EXPECT_EQ(numKnots - 3 - 1, BSplCLib::NbPoles(3, false, knots.mults));
+}
+
+// Timing only, not part of the regular unit run. Run it explicitly with
+// --gtest_also_run_disabled_tests --gtest_filter=*ParseKnotVectorBenchmark
+TEST(OCXHelperTest, DISABLED_ParseKnotVectorBenchmark) {
+  // Clamped knot vector of a large hull surface: 2000 distinct knots with
+  // multiplicity 4 at both ends
+  int const numUnique = 2000;
+  std::string knotVector;
+  for (int i = 0; i < numUnique; i++) {
+    int const mult = (i == 0 || i == numUnique - 1) ? 4 : 1;
+    for (int m = 0; m < mult; m++) {
+      knotVector += std::to_string(i * 0.125) + " ";
+    }
+  }
+  int const numKnots = numUnique + 6;
+
+  int const numRuns = 200;
+  auto const start = std::chrono::steady_clock::now();
+  for (int run = 0; run < numRuns; run++) {
+    ocx::helper::KnotMults knots =
+        ocx::helper::ParseKnotVector(knotVector, numKnots);
+    ASSERT_FALSE(knots.IsNull);
+    ASSERT_EQ(numUnique, knots.knots.Length());
+  }
+  auto const elapsed = std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - start);
+
+  std::cout << "ParseKnotVector: " << numKnots << " knots in "
+            << elapsed.count() / numRuns << " us per run" << std::endl;
+}
+
+TEST(OCXHelperTest, ParseKnotVectorLastKnot) {
+  // Unclamped knot vector, the last knot has multiplicity 1
+  ocx::helper::KnotMults knots =
+      ocx::helper::ParseKnotVector("0 1 2 3 4 5 6", 7);
+
+  EXPECT_FALSE(knots.IsNull);
+  EXPECT_EQ(7, knots.knots.Length());
+  EXPECT_DOUBLE_EQ(6, knots.knots.Last());
+}
+
 TEST(OCXHelperTest, ParseControlPoints) {}
+
+TEST(OCXHelperTest, IntersectPlanarPatch) {
+  // Planar degree 1 NURBS patch spanning [0, 1] x [0, 2] in the z=0 plane
+  TColgp_Array2OfPnt poles(1, 2, 1, 2);
+  poles(1, 1) = gp_Pnt(0, 0, 0);
+  poles(2, 1) = gp_Pnt(1, 0, 0);
+  poles(1, 2) = gp_Pnt(0, 2, 0);
+  poles(2, 2) = gp_Pnt(1, 2, 0);
+  TColStd_Array1OfReal knots(1, 2);
+  knots(1) = 0;
+  knots(2) = 1;
+  TColStd_Array1OfInteger mults(1, 2);
+  mults(1) = 2;
+  mults(2) = 2;
+  GeomAdaptor_Surface const patch(
+      new Geom_BSplineSurface(poles, knots, knots, mults, mults, 1, 1));
+
+  // The intersection ends at the patch instead of running along the
+  // infinite plane the patch lies in
+  GeomAdaptor_Surface const plane(
+      new Geom_Plane(gp_Pnt(0.5, 0, 0), gp_Dir(1, 0, 0)));
+  std::optional<TopoDS_Edge> edge = ocx::helper::Intersection(patch, plane);
+  ASSERT_TRUE(edge.has_value());
+  ASSERT_FALSE(edge->IsNull());
+
+  BRepAdaptor_Curve const curve(*edge);
+  ASSERT_FALSE(Precision::IsInfinite(curve.FirstParameter()));
+  ASSERT_FALSE(Precision::IsInfinite(curve.LastParameter()));
+  gp_Pnt first = curve.Value(curve.FirstParameter());
+  gp_Pnt last = curve.Value(curve.LastParameter());
+  if (first.Y() > last.Y()) std::swap(first, last);
+  double const tolerance = 1e-5;
+  EXPECT_NEAR(first.X(), 0.5, tolerance);
+  EXPECT_NEAR(first.Y(), 0, tolerance);
+  EXPECT_NEAR(first.Z(), 0, tolerance);
+  EXPECT_NEAR(last.X(), 0.5, tolerance);
+  EXPECT_NEAR(last.Y(), 2, tolerance);
+  EXPECT_NEAR(last.Z(), 0, tolerance);
+
+  // The same surfaces the other way round
+  std::optional<TopoDS_Edge> swapped = ocx::helper::Intersection(plane, patch);
+  ASSERT_TRUE(swapped.has_value());
+  BRepAdaptor_Curve const swappedCurve(*swapped);
+  EXPECT_NEAR(swappedCurve.LastParameter() - swappedCurve.FirstParameter(),
+              curve.LastParameter() - curve.FirstParameter(), tolerance);
+
+  // A plane missing the patch does not intersect it
+  GeomAdaptor_Surface const farPlane(
+      new Geom_Plane(gp_Pnt(2, 0, 0), gp_Dir(1, 0, 0)));
+  EXPECT_FALSE(ocx::helper::Intersection(patch, farPlane).has_value());
+}
+
+TEST(OCXHelperTest, GlobMatch) {
+  EXPECT_TRUE(ocx::helper::GlobMatch("B12*", "B12_DECK_3"));
+  EXPECT_TRUE(ocx::helper::GlobMatch("*", ""));
+  EXPECT_TRUE(ocx::helper::GlobMatch("*_DECK_?", "B12_DECK_3"));
+  EXPECT_FALSE(ocx::helper::GlobMatch("B12*", "B13_DECK_3"));
+  EXPECT_FALSE(ocx::helper::GlobMatch("*_DECK_?", "B12_DECK_"));
+}
+
+TEST(OCXHelperTest, ParseDouble) {
+  double value = 0;
+  EXPECT_TRUE(ocx::utils::ParseDouble("1.5e3", value));
+  EXPECT_DOUBLE_EQ(value, 1500);
+  EXPECT_TRUE(ocx::utils::ParseDouble(" +2.25 ", value));
+  EXPECT_DOUBLE_EQ(value, 2.25);
+  EXPECT_TRUE(ocx::utils::ParseDouble("-0.5", value));
+  EXPECT_DOUBLE_EQ(value, -0.5);
+
+  // Failures leave the value untouched
+  EXPECT_FALSE(ocx::utils::ParseDouble("", value));
+  EXPECT_FALSE(ocx::utils::ParseDouble("1,5", value));
+  EXPECT_DOUBLE_EQ(value, -0.5);
+}
+
+TEST(OCXHelperTest, ParallelFor) {
+  std::vector<std::size_t> results(1000);
+  ocx::utils::ParallelFor(results.size(), 4,
+                          [&](std::size_t i) { results[i] = i * i; });
+  for (std::size_t i = 0; i < results.size(); i++) {
+    EXPECT_EQ(results[i], i * i);
+  }
+
+  // Exceptions are rethrown on the calling thread
+  EXPECT_THROW(ocx::utils::ParallelFor(100, 4,
+                                       [](std::size_t i) {
+                                         if (i == 42) {
+                                           throw std::runtime_error("42");
+                                         }
+                                       }),
+               std::runtime_error);
+}
+
+TEST(OCXHelperTest, TaskGraph) {
+  ocx::utils::TaskGraph graph;
+  std::vector<int> order;
+  std::mutex mutex;
+  auto task = [&](int value) {
+    return [&, value]() {
+      std::lock_guard lock(mutex);
+      order.push_back(value);
+    };
+  };
+
+  auto a = graph.Add(task(1));
+  auto b = graph.Add(task(2), {a});
+  graph.Add(task(3), {a, b});
+  graph.Run(4);
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+
+  // Dependencies on tasks added later are rejected
+  EXPECT_THROW(graph.Add(task(4), {42}), std::invalid_argument);
+}
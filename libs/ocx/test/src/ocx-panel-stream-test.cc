@@ -0,0 +1,313 @@
+/***************************************************************************
+ *   Created on: 17 Oct 2026                                               *
+ ***************************************************************************
+ *   Copyright (c) 2026, Carsten Zerbst (carsten.zerbst@groy-groy.de)      *
+ *   Copyright (c) 2026, Paul Buechner                                     *
+ *                                                                         *
+ *   This file is part of the OCXReader library.                           *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Lesser General Public License    *
+ *   version 2.1 as published by the Free Software Foundation.             *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "ocx/internal/ocx-panel-stream.h"
+
+#include <LDOMParser.hxx>
+#include <LDOM_Document.hxx>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ocx/internal/ocx-decompress.h"
+#include "ocx/internal/ocx-mapped-file.h"
+#include "ocx/internal/ocx-panel-index.h"
+
+namespace {
+
+/**
+ * Write the given content to a temporary file, removed on destruction
+ */
+class TempFile {
+ public:
+  TempFile(std::string const &name, std::string_view content)
+      : m_path((std::filesystem::temp_directory_path() / name).string()) {
+    std::ofstream os(m_path, std::ios::binary);
+    os.write(content.data(), static_cast<std::streamsize>(content.size()));
+  }
+  ~TempFile() { std::remove(m_path.c_str()); }
+
+  [[nodiscard]] std::string const &Path() const { return m_path; }
+
+ private:
+  std::string m_path;
+};
+
+}  // namespace
+
+TEST(OCXPanelStreamTest, ParseMappedFile) {
+  std::string const document =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<ocx:ocxXML xmlns:ocx=\"https://3docx.org/fileadmin//ocx_schema//V286//"
+      "OCX_Schema.xsd\"><ocx:Vessel/></ocx:ocxXML>\n";
+  TempFile file("ocx-panel-stream-test-mapped.3docx", document);
+
+  auto mappedFile = ocx::stream::MappedFile::Open(file.Path());
+  ASSERT_NE(mappedFile, nullptr);
+  std::string_view data = mappedFile->Data();
+  ocx::stream::MemoryBuffer buffer(data.data(), data.data() + data.size());
+  std::istream is(&buffer);
+
+  // Detecting the compression must leave the stream at its start
+  EXPECT_EQ(ocx::stream::DetectCompression(is),
+            ocx::stream::Compression::None);
+  EXPECT_TRUE(is.good());
+  EXPECT_EQ(is.tellg(), std::streampos(0));
+
+  LDOMParser parser;
+  ASSERT_FALSE(parser.parse(is, Standard_True, Standard_False));
+  EXPECT_EQ(std::string_view(parser.getDocument()
+                                 .getDocumentElement()
+                                 .getTagName()
+                                 .GetString()),
+            "ocx:ocxXML");
+}
+
+TEST(OCXPanelStreamTest, DetectMappedCompression) {
+  std::string const gzipMagic("\x1F\x8B\x08\x00", 4);
+  TempFile file("ocx-panel-stream-test-mapped.3docx.gz", gzipMagic);
+
+  auto mappedFile = ocx::stream::MappedFile::Open(file.Path());
+  ASSERT_NE(mappedFile, nullptr);
+  std::string_view data = mappedFile->Data();
+  ocx::stream::MemoryBuffer buffer(data.data(), data.data() + data.size());
+  std::istream is(&buffer);
+
+  EXPECT_EQ(ocx::stream::DetectCompression(is),
+            ocx::stream::Compression::Gzip);
+  EXPECT_EQ(is.tellg(), std::streampos(0));
+  EXPECT_EQ(is.get(), 0x1F);
+}
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+std::string const kDocumentBegin =
+    "<?xml version=\"1.0\"?>\n<ocx:ocxXML><ocx:Vessel>";
+std::string const kDocumentEnd = "</ocx:Vessel></ocx:ocxXML>";
+
+std::string_view PanelText(std::string_view document,
+                           ocx::stream::PanelRange const &range) {
+  return document.substr(static_cast<std::size_t>(range.begin),
+                         static_cast<std::size_t>(range.end - range.begin));
+}
+
+}  // namespace
+
+TEST(OCXPanelStreamTest, SplitPanels) {
+  std::string const panelA =
+      "<ocx:Panel ocx:GUIDRef=\"A\" id=\"pA\"><ocx:Plate/></ocx:Panel>";
+  std::string const panelB = "<ocx:Panel ocx:GUIDRef='B' id='pB'/>";
+  std::string const document = kDocumentBegin + "<ocx:CoordinateSystem/>" +
+                               panelA + panelB + kDocumentEnd;
+
+  std::string skeleton;
+  std::vector<ocx::stream::PanelRange> panels;
+  ASSERT_TRUE(ocx::stream::SplitPanels(document, skeleton, panels));
+
+  ASSERT_EQ(panels.size(), 2);
+  EXPECT_EQ(PanelText(document, panels[0]), panelA);
+  EXPECT_EQ(panels[0].guid, "A");
+  EXPECT_EQ(panels[0].id, "pA");
+  // Self-closing Panels are split as well
+  EXPECT_EQ(PanelText(document, panels[1]), panelB);
+  EXPECT_EQ(panels[1].guid, "B");
+  EXPECT_EQ(panels[1].id, "pB");
+  EXPECT_EQ(skeleton,
+            kDocumentBegin + "<ocx:CoordinateSystem/>" + kDocumentEnd);
+}
+
+TEST(OCXPanelStreamTest, SplitPanelsNested) {
+  // Only the Panels directly below the Vessel are split, Panels nested in
+  // them or found elsewhere in the document stay where they are
+  std::string const panel =
+      "<ocx:Panel ocx:GUIDRef=\"A\"><ocx:Panel ocx:GUIDRef=\"B\">"
+      "<ocx:Panel/></ocx:Panel></ocx:Panel>";
+  std::string const elsewhere =
+      "<ocx:ClassCatalogue><ocx:Panel ocx:GUIDRef=\"C\"/>"
+      "</ocx:ClassCatalogue>";
+  std::string const document = kDocumentBegin + elsewhere + panel +
+                               kDocumentEnd;
+
+  std::string skeleton;
+  std::vector<ocx::stream::PanelRange> panels;
+  ASSERT_TRUE(ocx::stream::SplitPanels(document, skeleton, panels));
+
+  ASSERT_EQ(panels.size(), 1);
+  EXPECT_EQ(PanelText(document, panels[0]), panel);
+  EXPECT_EQ(panels[0].guid, "A");
+  EXPECT_EQ(skeleton, kDocumentBegin + elsewhere + kDocumentEnd);
+}
+
+TEST(OCXPanelStreamTest, SplitPanelsIgnoresMarkupInText) {
+  // Comments, CDATA sections and attribute values mentioning a Panel are
+  // not taken for Panel elements
+  std::string const text =
+      "<!-- <ocx:Panel ocx:GUIDRef=\"X\"> -->"
+      "<ocx:Description><![CDATA[<ocx:Panel>]]></ocx:Description>"
+      "<ocx:Header note=\"<ocx:Panel>\" other='a > b'/>";
+  std::string const panel = "<ocx:Panel ocx:GUIDRef=\"A\"></ocx:Panel>";
+  std::string const document = kDocumentBegin + text + panel + kDocumentEnd;
+
+  std::string skeleton;
+  std::vector<ocx::stream::PanelRange> panels;
+  ASSERT_TRUE(ocx::stream::SplitPanels(document, skeleton, panels));
+
+  ASSERT_EQ(panels.size(), 1);
+  EXPECT_EQ(PanelText(document, panels[0]), panel);
+  EXPECT_EQ(skeleton, kDocumentBegin + text + kDocumentEnd);
+}
+
+TEST(OCXPanelStreamTest, SplitPanelsChunkBoundaries) {
+  // Streams are scanned in chunks of 64 KiB, move the Panel start tag across
+  // the first chunk boundary character by character
+  std::string const panel =
+      "<ocx:Panel ocx:GUIDRef=\"A\" id=\"pA\"><ocx:Plate/></ocx:Panel>";
+  std::size_t const chunkSize = 1 << 16;
+
+  for (std::size_t shift = 0; shift < 40; shift++) {
+    std::string const padding =
+        "<!--" +
+        std::string(chunkSize - kDocumentBegin.size() - 7 - shift, ' ') +
+        "-->";
+    std::string const document =
+        kDocumentBegin + padding + panel + kDocumentEnd;
+
+    std::string skeleton;
+    std::vector<ocx::stream::PanelRange> panels;
+    std::istringstream is(document);
+    ASSERT_TRUE(ocx::stream::SplitPanels(is, skeleton, panels)) << shift;
+
+    ASSERT_EQ(panels.size(), 1) << shift;
+    EXPECT_EQ(PanelText(document, panels[0]), panel) << shift;
+    EXPECT_EQ(panels[0].guid, "A") << shift;
+    EXPECT_EQ(panels[0].id, "pA") << shift;
+    EXPECT_EQ(skeleton, kDocumentBegin + padding + kDocumentEnd) << shift;
+  }
+}
+
+TEST(OCXPanelStreamTest, SplitPanelsTruncated) {
+  std::string const document =
+      kDocumentBegin + "<ocx:Panel ocx:GUIDRef=\"A\"></ocx:Panel>" +
+      kDocumentEnd;
+
+  // Cut the document at every position once the root element has been
+  // started, none of them is a complete document. Whether there is a root
+  // element at all is left to the XML parser.
+  for (std::size_t size = document.find("<ocx:ocxXML") + 1;
+       size < document.size(); size++) {
+    std::string skeleton;
+    std::vector<ocx::stream::PanelRange> panels;
+    EXPECT_FALSE(ocx::stream::SplitPanels(std::string_view(document).substr(
+                                              0, size),
+                                          skeleton, panels))
+        << size;
+  }
+
+  // Unbalanced end tags are rejected as well
+  std::string skeleton;
+  std::vector<ocx::stream::PanelRange> panels;
+  EXPECT_FALSE(ocx::stream::SplitPanels(document + "</ocx:ocxXML>", skeleton,
+                                        panels));
+}
+
+TEST(OCXPanelStreamTest, SplitPanelsPlates) {
+  // Only the Plates the Panel is composed of are recorded
+  std::string const panel =
+      "<ocx:Panel ocx:GUIDRef=\"A\"><ocx:ComposedOf>"
+      "<ocx:Plate ocx:GUIDRef=\"P1\"><ocx:Plate ocx:GUIDRef=\"X1\"/>"
+      "</ocx:Plate><ocx:Plate ocx:GUIDRef=\"P2\"/><ocx:Plate/>"
+      "</ocx:ComposedOf><ocx:StiffenedBy><ocx:Plate ocx:GUIDRef=\"X2\"/>"
+      "</ocx:StiffenedBy></ocx:Panel>";
+  std::string const document =
+      kDocumentBegin + panel + "<ocx:Panel ocx:GUIDRef=\"B\"/>" + kDocumentEnd;
+
+  std::string skeleton;
+  std::vector<ocx::stream::PanelRange> panels;
+  ASSERT_TRUE(ocx::stream::SplitPanels(document, skeleton, panels));
+
+  ASSERT_EQ(panels.size(), 2);
+  EXPECT_EQ(panels[0].plateGuids, (std::vector<std::string>{"P1", "P2"}));
+  EXPECT_TRUE(panels[1].plateGuids.empty());
+}
+
+TEST(OCXPanelStreamTest, FindOwner) {
+  std::string const document =
+      kDocumentBegin +
+      "<ocx:Panel ocx:GUIDRef=\"A\" id=\"pA\"><ocx:ComposedOf>"
+      "<ocx:Plate ocx:GUIDRef=\"P1\"/></ocx:ComposedOf></ocx:Panel>"
+      "<ocx:Panel ocx:GUIDRef=\"B\" id=\"pB\"/>" +
+      kDocumentEnd;
+
+  std::string skeleton;
+  std::vector<ocx::stream::PanelRange> panels;
+  ASSERT_TRUE(ocx::stream::SplitPanels(document, skeleton, panels));
+  ocx::stream::PanelStream panelStream(
+      std::make_shared<std::istringstream>(document), panels);
+
+  EXPECT_EQ(panelStream.FindPanel("A"), 0);
+  EXPECT_EQ(panelStream.FindPanel("pB"), 1);
+  EXPECT_FALSE(panelStream.FindPanel("P1").has_value());
+
+  EXPECT_EQ(panelStream.FindOwner("P1"), 0);
+  EXPECT_EQ(panelStream.FindOwner("A"), 0);
+  EXPECT_EQ(panelStream.FindOwner("B"), 1);
+  EXPECT_FALSE(panelStream.FindOwner("P2").has_value());
+
+  // Panels may be read in any order
+  std::vector<LDOM_Element> elements = panelStream.ReadPanels({1, 0});
+  ASSERT_EQ(elements.size(), 2);
+  ASSERT_FALSE(elements[0].isNull());
+  ASSERT_FALSE(elements[1].isNull());
+  EXPECT_STREQ(elements[0].getAttribute("ocx:GUIDRef").GetString(), "B");
+  EXPECT_STREQ(elements[1].getAttribute("ocx:GUIDRef").GetString(), "A");
+}
+
+TEST(OCXPanelStreamTest, PanelIndex) {
+  std::string const document =
+      kDocumentBegin +
+      "<ocx:Panel ocx:GUIDRef=\"A\"><ocx:ComposedOf>"
+      "<ocx:Plate ocx:GUIDRef=\"P1\"/><ocx:Plate ocx:GUIDRef=\"P2\"/>"
+      "</ocx:ComposedOf></ocx:Panel><ocx:Panel id=\"pB\"/>" +
+      kDocumentEnd;
+  TempFile file("ocx-panel-stream-test-index.3docx", document);
+
+  std::string skeleton;
+  std::vector<ocx::stream::PanelRange> panels;
+  ASSERT_TRUE(ocx::stream::SplitPanels(document, skeleton, panels));
+  ASSERT_TRUE(ocx::stream::WritePanelIndex(file.Path(), panels));
+
+  std::vector<ocx::stream::PanelRange> indexed;
+  bool const read = ocx::stream::ReadPanelIndex(file.Path(), indexed);
+  std::remove(ocx::stream::PanelIndexPath(file.Path()).c_str());
+  ASSERT_TRUE(read);
+
+  ASSERT_EQ(indexed.size(), panels.size());
+  for (std::size_t i = 0; i < panels.size(); i++) {
+    EXPECT_EQ(indexed[i].begin, panels[i].begin) << i;
+    EXPECT_EQ(indexed[i].end, panels[i].end) << i;
+    EXPECT_EQ(indexed[i].guid, panels[i].guid) << i;
+    EXPECT_EQ(indexed[i].id, panels[i].id) << i;
+    EXPECT_EQ(indexed[i].plateGuids, panels[i].plateGuids) << i;
+  }
+}
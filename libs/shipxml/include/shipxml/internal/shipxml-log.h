@@ -18,6 +18,8 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <mutex>
+
 namespace shipxml {
 
 /**
@@ -26,12 +28,14 @@ namespace shipxml {
 class Log {
  public:
   /**
-   * Initialize the shipxml logging system
+   * Initialize the shipxml logging system. Calls are counted, so several
+   * drivers may initialize the logging system at the same time.
    */
   static void Initialize();
 
   /**
-   * Shutdown the shipxml logging system
+   * Shutdown the shipxml logging system once the last user has called
+   * Shutdown
    */
   static void Shutdown();
 
@@ -42,6 +46,12 @@ class Log {
    * shutdown when the shipxml library is unloaded or not.
    */
   static bool m_initializedThroughConfigFile;
+
+  /**
+   * Number of Initialize calls not yet matched by a Shutdown call
+   */
+  static int m_users;
+  static std::mutex m_mutex;
 };
 
 }  // namespace shipxml
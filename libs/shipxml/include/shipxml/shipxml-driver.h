@@ -17,6 +17,7 @@
 
 #include <LDOM_Document.hxx>
 #include <LDOM_Element.hxx>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -36,13 +37,16 @@ namespace shipxml {
  */
 class ShipXMLDriver {
  public:
-  ShipXMLDriver();
+  /**
+   * @param ctx the OCX context holding the document and its parsed geometry
+   * @throws SHIPXMLNotFoundException if the context is null
+   */
+  explicit ShipXMLDriver(std::shared_ptr<ocx::OCXContext> ctx);
   ~ShipXMLDriver();
 
   /**
-   * Transfer the given OCX document and its parsed geometry into a
+   * Transfer the OCX document of the context and its parsed geometry into a
    * ShipSteelTransfer entity
-   * @param ctx the OCX context holding the described information
    * @return true if the transfer was successfully
    */
   [[nodiscard]] bool Transfer() const;
@@ -63,6 +67,7 @@ class ShipXMLDriver {
   GetShipSteelTransfer() const;
 
  private:
+  std::shared_ptr<ocx::OCXContext> m_ctx;
   std::shared_ptr<shipxml::ShipSteelTransfer> m_sst;
 
   LDOM_Document m_sxDoc;
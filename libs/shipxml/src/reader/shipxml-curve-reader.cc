@@ -32,6 +32,29 @@
 
 namespace shipxml {
 
+namespace {
+
+struct CurveReader {
+  std::vector<ArcSegment> (*read)(LDOM_Element const&, AMCurve const&);
+  // Closed curves make up the whole curve
+  bool closed;
+};
+
+constexpr ocx::utils::AtomMap<CurveReader, 8> curveReaders({
+    {ocx::utils::Atom::CompositeCurve3D, {&ReadCompositeCurve3D, false}},
+    {ocx::utils::Atom::Ellipse3D, {&ReadEllipse3D, true}},
+    {ocx::utils::Atom::CircumCircle3D, {&ReadCircumCircle3D, true}},
+    {ocx::utils::Atom::Circle3D, {&ReadCircle3D, true}},
+    {ocx::utils::Atom::CircumArc3D, {&ReadCircumArc3D, false}},
+    {ocx::utils::Atom::Line3D, {&ReadLine3D, false}},
+    {ocx::utils::Atom::PolyLine3D, {&ReadPolyLine3D, false}},
+    {ocx::utils::Atom::NURBS3D, {&ReadNURBS3D, false}},
+});
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 shipxml::AMCurve ReadCurve(LDOM_Element const& curveRootN, MajorPlane const& mp,
                            gp_Dir const& normal) {
   auto meta = ocx::helper::GetOCXMeta(curveRootN);
@@ -50,40 +73,24 @@ shipxml::AMCurve ReadCurve(LDOM_Element const& curveRootN, MajorPlane const& mp,
     if (nodeType == LDOM_Node::ATTRIBUTE_NODE) break;
     if (nodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element curveN = (LDOM_Element&)childN;
-      std::string curveType = ocx::helper::GetLocalTagName(curveN);
-      if (curveType == "CompositeCurve3D") {
-        curveSegments = ReadCompositeCurve3D(curveN, crv);
-      } else if (curveType == "Ellipse3D") {
-        // By default, Ellipse3D should be a closed curve
-        curveSegments = ReadEllipse3D(curveN, crv);
-        break;
-      } else if (curveType == "CircumCircle3D") {
-        // By default, CircumCircle3D should be a closed curve
-        curveSegments = ReadCircumCircle3D(curveN, crv);
-        break;
-      } else if (curveType == "Circle3D") {
-        // By default, Circle3D should be a closed curve
-        curveSegments = ReadCircle3D(curveN, crv);
-        break;
-      } else if (curveType == "CircumArc3D") {
-        curveSegments = ReadCircumArc3D(curveN, crv);
-      } else if (curveType == "Line3D") {
-        curveSegments = ReadLine3D(curveN, crv);
-      } else if (curveType == "PolyLine3D") {
-        curveSegments = ReadPolyLine3D(curveN, crv);
-      } else if (curveType == "NURBS3D") {
-        curveSegments = ReadNURBS3D(curveN, crv);
-      } else {
+      auto const curveType = ocx::helper::GetLocalTagAtom(curveN);
+      auto reader = curveReaders.Find(curveType);
+      if (reader == nullptr) {
         SHIPXML_WARN(
             "Found unsupported curve type {} in curve {} id={} guid={}",
-            curveType, meta->name, meta->id, meta->guid)
+            ocx::utils::AtomName(curveType), meta->name, meta->id, meta->guid)
         childN = childN.getNextSibling();
         continue;
       }
+      curveSegments = reader->read(curveN, crv);
+      if (reader->closed) {
+        break;
+      }
 
       if (curveSegments.empty()) {
         SHIPXML_WARN("Failed to read curve type {} in curve {} id={} guid={}",
-                     curveType, meta->name, meta->id, meta->guid)
+                     ocx::utils::AtomName(curveType), meta->name, meta->id,
+                     meta->guid)
 
       } else {
         SHIPXML_INFO("Add #{} arcs", curveSegments.size())
@@ -108,7 +115,8 @@ std::vector<ArcSegment> ReadNURBS3D(const LDOM_Element& nurbs3DN,
   SHIPXML_DEBUG("    ReadNURBS3D {} on  {}", meta->id,
                 magic_enum::enum_name(amCurve.GetSystem()).data());
 
-  LDOM_Element propsN = ocx::helper::GetFirstChild(nurbs3DN, "NURBSproperties");
+  LDOM_Element propsN =
+      ocx::helper::GetFirstChild(nurbs3DN, ocx::utils::Atom::NURBSproperties);
   if (propsN.isNull()) {
     SHIPXML_ERROR(
         "No NURBSproperties child node found in NURBS3D with curve id={}",
@@ -132,7 +140,8 @@ std::vector<ArcSegment> ReadNURBS3D(const LDOM_Element& nurbs3DN,
       isRational)
 
   // Parse knotVector
-  LDOM_Element knotVectorN = ocx::helper::GetFirstChild(nurbs3DN, "KnotVector");
+  LDOM_Element knotVectorN =
+      ocx::helper::GetFirstChild(nurbs3DN, ocx::utils::Atom::KnotVector);
   if (knotVectorN.isNull()) {
     SHIPXML_ERROR("No KnotVector child node found in NURBS3D with curve id={}",
                   meta->id)
@@ -149,7 +158,7 @@ std::vector<ArcSegment> ReadNURBS3D(const LDOM_Element& nurbs3DN,
 
   // Parse control Points
   LDOM_Element controlPtListN =
-      ocx::helper::GetFirstChild(nurbs3DN, "ControlPtList");
+      ocx::helper::GetFirstChild(nurbs3DN, ocx::utils::Atom::ControlPtList);
   if (controlPtListN.isNull()) {
     SHIPXML_ERROR(
         "No ControlPtList child node found in NURBS3D with curve id={}",
@@ -285,7 +294,8 @@ std::vector<ArcSegment> ReadLine3D(const LDOM_Element& lineEL,
                                    AMCurve const& curve) {
   auto meta = ocx::helper::GetOCXMeta(lineEL);
 
-  LDOM_Element startN = ocx::helper::GetFirstChild(lineEL, "StartPoint");
+  LDOM_Element startN =
+      ocx::helper::GetFirstChild(lineEL, ocx::utils::Atom::StartPoint);
   if (startN.isNull()) {
     SHIPXML_ERROR(
         "No StartPoint child node found in Line3D with curve id={} guid={}",
@@ -293,7 +303,8 @@ std::vector<ArcSegment> ReadLine3D(const LDOM_Element& lineEL,
     return {};
   }
 
-  LDOM_Element endN = ocx::helper::GetFirstChild(lineEL, "EndPoint");
+  LDOM_Element endN =
+      ocx::helper::GetFirstChild(lineEL, ocx::utils::Atom::EndPoint);
   if (endN.isNull()) {
     SHIPXML_ERROR(
         "No EndPoint child node found in Line3D with curve id={} guid={}",
@@ -313,7 +324,8 @@ std::vector<ArcSegment> ReadCircumArc3D(const LDOM_Element& circleN,
                                         AMCurve const& curve) {
   auto meta = ocx::helper::GetOCXMeta(circleN);
 
-  LDOM_Element startN = ocx::helper::GetFirstChild(circleN, "StartPoint");
+  LDOM_Element startN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::StartPoint);
   if (startN.isNull()) {
     SHIPXML_ERROR(
         "No StartPoint child node found in CircumArc3D with curve id={} "
@@ -322,7 +334,8 @@ std::vector<ArcSegment> ReadCircumArc3D(const LDOM_Element& circleN,
     return {};
   }
 
-  LDOM_Element intN = ocx::helper::GetFirstChild(circleN, "IntermediatePoint");
+  LDOM_Element intN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::IntermediatePoint);
   if (intN.isNull()) {
     SHIPXML_ERROR(
         "No IntermediatePoint child node found in CircumArc3D with curve "
@@ -332,7 +345,8 @@ std::vector<ArcSegment> ReadCircumArc3D(const LDOM_Element& circleN,
     return {};
   }
 
-  LDOM_Element endN = ocx::helper::GetFirstChild(circleN, "EndPoint");
+  LDOM_Element endN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::EndPoint);
   if (endN.isNull()) {
     SHIPXML_ERROR(
         "No EndPoint child node found in CircumArc3D with curve id={} "
@@ -386,7 +400,8 @@ std::vector<ArcSegment> ReadCircle3D(const LDOM_Element& circleN,
 
   auto meta = ocx::helper::GetOCXMeta(circleN);
 
-  LDOM_Element startN = ocx::helper::GetFirstChild(circleN, "StartPoint");
+  LDOM_Element startN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::StartPoint);
   if (startN.isNull()) {
     SHIPXML_ERROR(
         "No StartPoint child node found in CircumArc3D with curve id={} "
@@ -395,7 +410,8 @@ std::vector<ArcSegment> ReadCircle3D(const LDOM_Element& circleN,
     return {};
   }
 
-  LDOM_Element intN = ocx::helper::GetFirstChild(circleN, "IntermediatePoint");
+  LDOM_Element intN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::IntermediatePoint);
   if (intN.isNull()) {
     SHIPXML_ERROR(
         "No IntermediatePoint child node found in CircumArc3D with curve "
@@ -405,7 +421,8 @@ std::vector<ArcSegment> ReadCircle3D(const LDOM_Element& circleN,
     return {};
   }
 
-  LDOM_Element endN = ocx::helper::GetFirstChild(circleN, "EndPoint");
+  LDOM_Element endN =
+      ocx::helper::GetFirstChild(circleN, ocx::utils::Atom::EndPoint);
   if (endN.isNull()) {
     SHIPXML_ERROR(
         "No EndPoint child node found in CircumArc3D with curve id={} "
@@ -23,6 +23,7 @@
 
 #include "occutils/occutils-shape-components.h"
 #include "occutils/occutils-surface.h"
+#include "ocx/internal/ocx-panel.h"
 #include "ocx/ocx-helper.h"
 #include "shipxml/internal/shipxml-enums.h"
 #include "shipxml/internal/shipxml-limit.h"
@@ -39,21 +40,14 @@ PanelReader::PanelReader(LDOM_Element const &vesselN,
 //-----------------------------------------------------------------------------
 
 void PanelReader::ReadPanels() const {
-  LDOM_Node aChildNode = m_ocxVesselEL.getFirstChild();
-
-  while (aChildNode != nullptr) {
-    const LDOM_Node::NodeType aNodeType = aChildNode.getNodeType();
-    if (aNodeType == LDOM_Node::ATTRIBUTE_NODE) break;
-    if (aNodeType == LDOM_Node::ELEMENT_NODE) {
-      LDOM_Element aElement = (LDOM_Element &)aChildNode;
-
-      if (ocx::helper::GetLocalTagName(aElement) == "Panel") {
-        Panel panel = ReadPanel(aElement);
+  ocx::reader::vessel::panel::ForEachPanel(
+      m_ocxVesselEL, [this](LDOM_Element const &panelN) {
+        if (!ocx::reader::vessel::panel::IsPanelSelected(panelN)) {
+          return;
+        }
+        Panel panel = ReadPanel(panelN);
         m_sst->GetStructure()->AddPanel(panel);
-      }
-    }
-    aChildNode = aChildNode.getNextSibling();
-  }
+      });
 }
 
 //-----------------------------------------------------------------------------
@@ -69,7 +63,8 @@ Panel PanelReader::ReadPanel(LDOM_Element const &panelN) {
     panel.GetProperties().Add(node.getNodeName().GetString(),
                               node.getNodeValue().GetString());
   }
-  if (auto descN = ocx::helper::GetFirstChild(panelN, "Description");
+  if (auto descN =
+          ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::Description);
       !descN.isNull()) {
     panel.GetProperties().Add("description",
                               descN.getFirstChild().getNodeValue().GetString());
@@ -83,7 +78,8 @@ Panel PanelReader::ReadPanel(LDOM_Element const &panelN) {
   ReadSupportAndOuterContour(panelN, panel);
 
   // the limits
-  if (auto limitedByN = ocx::helper::GetFirstChild(panelN, "LimitedBy");
+  if (auto limitedByN =
+          ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::LimitedBy);
       !limitedByN.isNull()) {
     ReadLimits(limitedByN, panel);
   } else {
@@ -109,8 +105,9 @@ void PanelReader::ReadLimits(LDOM_Element const &limitedByN, Panel &panel) {
     if (aNodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element aElement = (LDOM_Element &)aChildN;
       auto meta = ocx::helper::GetOCXMeta(aElement);
+      auto const tag = ocx::helper::GetLocalTagAtom(aElement);
 
-      if (ocx::helper::GetLocalTagName(aElement) == "FreeEdgeCurve3D") {
+      if (tag == ocx::utils::Atom::FreeEdgeCurve3D) {
         Limit limit(meta->id);
         limit.SetFeature(meta->name);
         limit.SetLimitType(LimitType::CURVE);
@@ -118,8 +115,8 @@ void PanelReader::ReadLimits(LDOM_Element const &limitedByN, Panel &panel) {
         limits.emplace_back(limit);
         // TODO: Get limit curve and write to an limit
 
-      } else if ((ocx::helper::GetLocalTagName(aElement) == "OcxItemPtr") ||
-                 ocx::helper::GetLocalTagName(aElement) == "GridRef") {
+      } else if (tag == ocx::utils::Atom::OcxItemPtr ||
+                 tag == ocx::utils::Atom::GridRef) {
         Limit limit(meta->localRef);
         limit.SetFeature(meta->guid);
         if (meta->refType == "GridRef") {
@@ -151,7 +148,7 @@ void PanelReader::ReadSupportAndOuterContour(const LDOM_Element &panelN,
   SHIPXML_INFO("ReadSupportAndOuterContour {}", panel.GetName());
 
   auto unboundedGeometryN =
-      ocx::helper::GetFirstChild(panelN, "UnboundedGeometry");
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::UnboundedGeometry);
   if (unboundedGeometryN.isNull()) {
     SHIPXML_WARN("No UnboundedGeometry found in Panel id={} guid={}", meta->id,
                  meta->guid)
@@ -164,7 +161,8 @@ void PanelReader::ReadSupportAndOuterContour(const LDOM_Element &panelN,
   // UnboundedGeometry is either a shell, a shell reference, or a grid reference
   LDOM_Element refN{};
   if (LDOM_Element gridRefN =
-          ocx::helper::GetFirstChild(unboundedGeometryN, "GridRef");
+          ocx::helper::GetFirstChild(unboundedGeometryN,
+                                     ocx::utils::Atom::GridRef);
       !gridRefN.isNull()) {
     refN = gridRefN;
 
@@ -224,7 +222,8 @@ void PanelReader::ReadSupportAndOuterContour(const LDOM_Element &panelN,
     SHIPXML_DEBUG("       Support grid {}, coordinates {}", support.GetGrid(),
                   support.GetCoordinate())
   } else if (LDOM_Element surfaceRefN =
-                 ocx::helper::GetFirstChild(unboundedGeometryN, "SurfaceRef");
+                 ocx::helper::GetFirstChild(unboundedGeometryN,
+                                            ocx::utils::Atom::SurfaceRef);
              !surfaceRefN.isNull()) {
     refN = surfaceRefN;
     SHIPXML_DEBUG("Using SurfaceRef guid={} as UnboundedGeometry",
@@ -325,7 +324,8 @@ void PanelReader::ReadSupportAndOuterContour(const LDOM_Element &panelN,
     return;
   }
 
-  auto outerContourN = ocx::helper::GetFirstChild(panelN, "OuterContour");
+  auto outerContourN =
+      ocx::helper::GetFirstChild(panelN, ocx::utils::Atom::OuterContour);
   if (outerContourN.isNull()) {
     SHIPXML_WARN("No OuterContour found in Panel id={} guid={}", meta->id,
                  meta->guid)
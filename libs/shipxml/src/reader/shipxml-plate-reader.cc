@@ -30,7 +30,8 @@ void PlateReader::ReadPlates(LDOM_Element const &ocxPanelN,
                              Panel &panel) const {
   SHIPXML_INFO("ReadPlates {}", panel.GetName())
 
-  auto composedOfEL = ocx::helper::GetFirstChild(ocxPanelN, "ComposedOf");
+  auto composedOfEL =
+      ocx::helper::GetFirstChild(ocxPanelN, ocx::utils::Atom::ComposedOf);
   if (composedOfEL.isNull()) {
     SHIPXML_INFO("    no ComposedOf found in {}", panel.GetName())
     return;
@@ -44,7 +45,7 @@ void PlateReader::ReadPlates(LDOM_Element const &ocxPanelN,
     if (aNodeType == LDOM_Node::ELEMENT_NODE) {
       LDOM_Element aElement = (LDOM_Element &)aChildNode;
 
-      if (ocx::helper::GetLocalTagName(aElement) == "Plate") {
+      if (ocx::helper::GetLocalTagAtom(aElement) == ocx::utils::Atom::Plate) {
         panel.AddPlate(ReadPlate(aElement, panel));
       }
     }
@@ -64,12 +65,14 @@ Plate PlateReader::ReadPlate(const LDOM_Element &plateN, Panel const &panel) {
   properties.Add("guid", meta->guid);
 
   if (LDOM_Element ppN =
-          ocx::helper::GetFirstChild(plateN, "PhysicalProperties");
+          ocx::helper::GetFirstChild(plateN,
+                                     ocx::utils::Atom::PhysicalProperties);
       ppN.isNull()) {
     SHIPXML_ERROR("No PhysicalProperties in Plate id={} guid={}", meta->id,
                   meta->guid)
   } else {
-    if (LDOM_Element cogN = ocx::helper::GetFirstChild(ppN, "CenterOfGravity");
+    if (LDOM_Element cogN =
+            ocx::helper::GetFirstChild(ppN, ocx::utils::Atom::CenterOfGravity);
         cogN.isNull()) {
       SHIPXML_ERROR("No CenterOfGravity found in Plate id={} guid={}", meta->id,
                     meta->guid)
@@ -78,7 +81,8 @@ Plate PlateReader::ReadPlate(const LDOM_Element &plateN, Panel const &panel) {
       properties.SetCog(cog);
     }
 
-    LDOM_Element wghtN = ocx::helper::GetFirstChild(ppN, "DryWeight");
+    LDOM_Element wghtN =
+        ocx::helper::GetFirstChild(ppN, ocx::utils::Atom::DryWeight);
     if (wghtN.isNull()) {
       SHIPXML_ERROR("No DryWeight found in Plate id={} guid={}", meta->id,
                     meta->guid)
@@ -94,7 +98,8 @@ Plate PlateReader::ReadPlate(const LDOM_Element &plateN, Panel const &panel) {
   if (!panel.GetSupport().IsPlanar()) {
     SHIPXML_DEBUG("Do not read OuterContour for none planar panels")
   } else {
-    auto outerContourN = ocx::helper::GetFirstChild(plateN, "OuterContour");
+    auto outerContourN =
+        ocx::helper::GetFirstChild(plateN, ocx::utils::Atom::OuterContour);
     if (outerContourN.isNull()) {
       SHIPXML_WARN("No OuterContour found in Panel id={} guid={}", meta->id,
                    meta->guid)
@@ -18,6 +18,7 @@
 #include <ctime>
 #include <magic_enum.hpp>
 #include <memory>
+#include <utility>
 
 #include "ocx/ocx-context.h"
 #include "ocx/ocx-helper.h"
@@ -45,12 +46,13 @@
 
 namespace shipxml {
 
-ShipXMLDriver::ShipXMLDriver() {
-  Log::Initialize();
-
-  if (ocx::OCXContext::GetInstance() == nullptr) {
+ShipXMLDriver::ShipXMLDriver(std::shared_ptr<ocx::OCXContext> ctx)
+    : m_ctx(std::move(ctx)) {
+  if (m_ctx == nullptr) {
     throw SHIPXMLNotFoundException("No OCX context available.");
   }
+  Log::Initialize();
+
   m_sst = std::make_shared<shipxml::ShipSteelTransfer>();
 }
 
@@ -61,9 +63,13 @@ ShipXMLDriver::~ShipXMLDriver() { Log::Shutdown(); }
 //-----------------------------------------------------------------------------
 
 bool ShipXMLDriver::Transfer() const {
-  LDOM_Element ocxDocEL = ocx::OCXContext::GetInstance()->OCXRoot();
+  // The readers access the context through OCXContext::GetInstance()
+  ocx::OCXContext::Scope scope(m_ctx);
+
+  LDOM_Element ocxDocEL = m_ctx->OCXRoot();
 
-  LDOM_Element vesselN = ocx::helper::GetFirstChild(ocxDocEL, "Vessel");
+  LDOM_Element vesselN =
+      ocx::helper::GetFirstChild(ocxDocEL, ocx::utils::Atom::Vessel);
 
   CoordinateSystemReader(vesselN, m_sst).ReadCoordinateSystem();
 
@@ -17,12 +17,18 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 #include <memory>
+#include <mutex>
 
 namespace shipxml {
 
 bool Log::m_initializedThroughConfigFile = false;
+int Log::m_users = 0;
+std::mutex Log::m_mutex;
 
 void Log::Initialize() {
+  std::lock_guard lock(m_mutex);
+  if (m_users++ > 0) return;
+
   // Check if logging already initialized
   if (spdlog::get(SHIPXML_DEFAULT_LOGGER_NAME) != nullptr) {
     m_initializedThroughConfigFile = true;
@@ -42,6 +48,8 @@ void Log::Initialize() {
 }
 
 void Log::Shutdown() {
+  std::lock_guard lock(m_mutex);
+  if (m_users == 0 || --m_users > 0) return;
   if (m_initializedThroughConfigFile) return;
   spdlog::shutdown();
 }
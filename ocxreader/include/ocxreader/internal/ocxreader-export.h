@@ -28,7 +28,8 @@ namespace ocxreader::file_export {
 int HandleExport(Handle(TDocStd_Document) const& doc,
                  Handle(TDocStd_Application) const& app,
                  std::string_view outputFilePath,
-                 std::vector<std::string> const& exportFormats);
+                 std::vector<std::string> const& exportFormats,
+                 std::shared_ptr<ocx::OCXContext> const& ctx);
 
 }  // namespace ocxreader::file_export
 
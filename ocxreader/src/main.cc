@@ -12,11 +12,16 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <Bnd_Box.hxx>
 #include <TDocStd_Application.hxx>
 #include <TDocStd_Document.hxx>
 #include <boost/program_options.hpp>
 #include <filesystem>
+#include <gp_Pnt.hxx>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "ocx/ocx-reader.h"
 #include "ocxreader/internal/ocxreader-cli.h"
@@ -38,7 +43,8 @@ int main(int argc, char** argv) {
 
   po::options_description opts("OCXReader configuration options");
   opts.add_options()                                                      //
-      ("input-file,i", po::value<std::string>(), "The OCX file to read")  //
+      ("input-file,i", po::value<std::string>(),
+       "The OCX file to read, may be gzip or zstd compressed")  //
       ("export-format", po::value<std::vector<std::string>>()->multitoken(),
        "The export format(s) to use. This can be one or more of the following: "
        "STEP, SHIPXML, XCAF-XML, XCAF-XBF")  //
@@ -51,7 +57,33 @@ int main(int argc, char** argv) {
        "export formats. If not defined input-file is used.")  //
       ("log-config-file,l", po::value<std::string>(),
        "The path to the file containing logging configuration options options "
-       "(e.g. path/to/log_conf.toml)");
+       "(e.g. path/to/log_conf.toml)")  //
+      ("stream-panels", po::bool_switch(),
+       "Read the Panel elements one at a time instead of loading the complete "
+       "OCX document into memory. Recommended for large files.")  //
+      ("map-input-file", po::bool_switch(),
+       "Memory-map the OCX file and parse it directly from the mapped pages "
+       "instead of reading it through file streams.")  //
+      ("parse-threads", po::value<unsigned int>()->default_value(1),
+       "The number of threads used to parse the Panel elements of the OCX "
+       "file. Use 0 to use all available cores.")  //
+      ("read-threads", po::value<unsigned int>()->default_value(1),
+       "The number of threads used to build the Panel geometry. Use 0 to use "
+       "all available cores. The result does not depend on the number of "
+       "threads.")  //
+      ("panel-index", po::bool_switch(),
+       "Use a sidecar index file (<input-file>.ocxidx) holding the byte "
+       "ranges of the Panel elements to avoid scanning the OCX file. The "
+       "index is written if it does not exist or is outdated.")  //
+      ("select-panels", po::value<std::vector<std::string>>()->multitoken(),
+       "Only read the Panels with the given GUIDRefs or ids")  //
+      ("select-name", po::value<std::string>(),
+       "Only read the Panels whose name matches the given glob pattern (e.g. "
+       "\"B12*\")")  //
+      ("select-box", po::value<std::string>(),
+       "Only read the Panels whose outer contour intersects the given box in "
+       "ship coordinates, given as minX,minY,minZ,maxX,maxY,maxZ in meters "
+       "(e.g. --select-box=-10,-50,-10,20,50,45)");
 
   po::options_description allopts("Allowed options");
   allopts.add(generic).add(opts);
@@ -149,6 +181,35 @@ int main(int argc, char** argv) {
     return 33;
   }
 
+  // Validate panel selection
+  if (vm.count("select-panels")) {
+    ocx::OCXContext::SelectPanelGUIDs =
+        vm["select-panels"].as<std::vector<std::string>>();
+  }
+  if (vm.count("select-name")) {
+    ocx::OCXContext::SelectPanelName = vm["select-name"].as<std::string>();
+  }
+  if (vm.count("select-box")) {
+    std::vector<double> coords;
+    std::istringstream boxStream(vm["select-box"].as<std::string>());
+    for (std::string coord; std::getline(boxStream, coord, ',');) {
+      try {
+        coords.push_back(std::stod(coord));
+      } catch (std::exception const&) {
+        break;
+      }
+    }
+    if (coords.size() != 6) {
+      std::cerr << "Invalid select-box, expected "
+                   "minX,minY,minZ,maxX,maxY,maxZ"
+                << std::endl;
+      return 33;
+    }
+    ocx::OCXContext::SelectPanelBox =
+        Bnd_Box(gp_Pnt(coords[0], coords[1], coords[2]),
+                gp_Pnt(coords[3], coords[4], coords[5]));
+  }
+
   std::string saveTo;
   if (vm.count("save-to")) {
     std::filesystem::path saveToPath(vm["save-to"].as<std::string>());
@@ -225,6 +286,11 @@ int main(int argc, char** argv) {
   }
 
   // Read and parse the OCX file
+  ocx::OCXContext::StreamPanels = vm["stream-panels"].as<bool>();
+  ocx::OCXContext::MapInputFile = vm["map-input-file"].as<bool>();
+  ocx::OCXContext::ParseThreads = vm["parse-threads"].as<unsigned int>();
+  ocx::OCXContext::ReadThreads = vm["read-threads"].as<unsigned int>();
+  ocx::OCXContext::UsePanelIndex = vm["panel-index"].as<bool>();
   std::shared_ptr<ocx::OCXContext> ctx;
   std::cout << "Read from " << ocxFileInput << std::endl;
   if (!ocx::OCXReader::Perform(ocxFileInput.c_str(), doc, ctx)) {
@@ -236,7 +302,7 @@ int main(int argc, char** argv) {
 
   // Handle the export
   if (int ret = ocxreader::file_export::HandleExport(doc, app, outputFilePath,
-                                                     exportFormats);
+                                                     exportFormats, ctx);
       ret == 66) {
     std::cerr << "Failed to export" << std::endl;
     app->Close(doc);
@@ -27,7 +27,8 @@ namespace ocxreader::file_export {
 int HandleExport(Handle(TDocStd_Document) const& doc,
                  Handle(TDocStd_Application) const& app,
                  std::string_view outputFilePath,
-                 std::vector<std::string> const& exportFormats) {
+                 std::vector<std::string> const& exportFormats,
+                 std::shared_ptr<ocx::OCXContext> const& ctx) {
   for (auto& format : exportFormats) {
     if (format == "STEP") {
       // Write to STEP
@@ -70,7 +71,7 @@ int HandleExport(Handle(TDocStd_Document) const& doc,
     }
 
     else if (format == "SHIPXML") {
-      shipxml::ShipXMLDriver xmlDriver;
+      shipxml::ShipXMLDriver xmlDriver(ctx);
       // try {
       if (!(xmlDriver.Transfer())) {
         std::cerr << "Failed to transfer document to ShipXML model"